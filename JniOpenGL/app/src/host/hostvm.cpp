@@ -0,0 +1,400 @@
+#include "hostvm.h"
+#include "textencoding.h"
+#include <android/log.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * JNIEnv methods nest at most one deep, but count anyway
+ */
+static thread_local int tVmDepth = 0;
+
+/**
+ * Marks the calling thread as inside the VM for the lifetime of the scope
+ */
+struct VmScope {
+    VmScope() { tVmDepth++; }
+    ~VmScope() { tVmDepth--; }
+};
+
+struct HostClass : public _jclass {
+    std::string name;
+};
+
+/**
+ * Java strings are UTF-16; the UTF-8 form is made on demand for
+ * GetStringUTFChars and for printing
+ */
+struct HostString : public _jstring {
+    std::u16string units;
+    std::string utf;
+    bool hasUtf = false;
+};
+
+/**
+ * Encodes UTF-16 as standard UTF-8; unpaired surrogates become U+FFFD
+ */
+static std::string utf16ToUtf8(const jchar* units, size_t length) {
+    std::string utf;
+    for (size_t i = 0; i < length; i++) {
+        uint32_t codePoint = units[i];
+        if (codePoint >= 0xd800 && codePoint <= 0xdbff && i + 1 < length
+            && units[i + 1] >= 0xdc00 && units[i + 1] <= 0xdfff) {
+            codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (units[++i] - 0xdc00);
+        } else if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+            codePoint = 0xfffd;
+        }
+        if (codePoint < 0x80) {
+            utf += (char) codePoint;
+        } else if (codePoint < 0x800) {
+            utf += (char) (0xc0 | (codePoint >> 6));
+            utf += (char) (0x80 | (codePoint & 0x3f));
+        } else if (codePoint < 0x10000) {
+            utf += (char) (0xe0 | (codePoint >> 12));
+            utf += (char) (0x80 | ((codePoint >> 6) & 0x3f));
+            utf += (char) (0x80 | (codePoint & 0x3f));
+        } else {
+            utf += (char) (0xf0 | (codePoint >> 18));
+            utf += (char) (0x80 | ((codePoint >> 12) & 0x3f));
+            utf += (char) (0x80 | ((codePoint >> 6) & 0x3f));
+            utf += (char) (0x80 | (codePoint & 0x3f));
+        }
+    }
+    return utf;
+}
+
+struct HostObjectArray : public _jobjectArray {
+    std::vector<jobject> elements;
+};
+
+template<typename Base, typename T>
+struct HostPrimitiveArray : public Base {
+    std::vector<T> elements;
+};
+
+typedef HostPrimitiveArray<_jintArray, jint> HostIntArray;
+typedef HostPrimitiveArray<_jlongArray, jlong> HostLongArray;
+typedef HostPrimitiveArray<_jfloatArray, jfloat> HostFloatArray;
+
+struct HostDirectBuffer : public _jobject {
+    void* address;
+    jlong capacity;
+};
+
+/**
+ * Aborts on JNI misuse, as CheckJNI would
+ */
+static void jniFatal(const char* what) {
+    fprintf(stderr, "JNI DETECTED ERROR IN APPLICATION: %s\n", what);
+    abort();
+}
+
+template<typename T, typename From>
+static T* checked(From* object, const char* what) {
+    T* result = dynamic_cast<T*>(object);
+    if (!result) {
+        jniFatal(what);
+    }
+    return result;
+}
+
+HostVm& HostVm::instance() {
+    static HostVm* vm = new HostVm();
+    return *vm;
+}
+
+void HostVm::keep(jobject object) {
+    auto found = std::find_if(mHeap.begin(), mHeap.end(),
+                              [&](const std::unique_ptr<_jobject>& owned) { return owned.get() == object; });
+    if (found != mHeap.end()) {
+        mKept.push_back(std::move(*found));
+        mHeap.erase(found);
+    }
+}
+
+void HostVm::collect() {
+    VmScope scope;
+    mHeap.clear();
+}
+
+static std::string nativeKey(const std::string& className, const char* name, const char* signature) {
+    return className + "." + name + " " + signature;
+}
+
+void* HostVm::registeredNative(const char* className, const char* name, const char* signature) const {
+    auto found = mNatives.find(nativeKey(className, name, signature));
+    return found != mNatives.end() ? found->second : nullptr;
+}
+
+void HostVm::registerNative(const std::string& className, const JNINativeMethod& method) {
+    mNatives[nativeKey(className, method.name, method.signature)] = method.fnPtr;
+}
+
+const std::string& HostVm::utf(jstring string) {
+    HostString* host = checked<HostString>(string, "utf of a non-string");
+    if (!host->hasUtf) {
+        host->utf = utf16ToUtf8((const jchar*) host->units.data(), host->units.size());
+        host->hasUtf = true;
+    }
+    return host->utf;
+}
+
+const std::u16string& HostVm::utf16(jstring string) {
+    return checked<HostString>(string, "utf16 of a non-string")->units;
+}
+
+bool HostVm::inVm() {
+    return tVmDepth > 0;
+}
+
+template<typename Array>
+static void checkRegion(Array* array, jsize start, jsize length) {
+    if (start < 0 || length < 0 || (size_t) start + (size_t) length > array->elements.size()) {
+        jniFatal("array region out of bounds");
+    }
+}
+
+template<typename Array, typename T>
+static void getRegion(jarray array, jsize start, jsize length, T* buffer) {
+    Array* host = checked<Array>(array, "array of the wrong type");
+    checkRegion(host, start, length);
+    std::copy(host->elements.begin() + start, host->elements.begin() + start + length, buffer);
+}
+
+template<typename Array, typename T>
+static void setRegion(jarray array, jsize start, jsize length, const T* buffer) {
+    Array* host = checked<Array>(array, "array of the wrong type");
+    checkRegion(host, start, length);
+    std::copy(buffer, buffer + length, host->elements.begin() + start);
+}
+
+template<typename Array>
+static Array* newArray(jsize length) {
+    Array* array = HostVm::instance().adopt(new Array());
+    array->elements.resize((size_t) std::max<jsize>(length, 0));
+    return array;
+}
+
+jclass _JNIEnv::FindClass(const char* name) {
+    VmScope scope;
+    HostClass* clazz = HostVm::instance().adopt(new HostClass());
+    clazz->name = name;
+    return clazz;
+}
+
+jint _JNIEnv::RegisterNatives(jclass clazz, const JNINativeMethod* methods, jint methodCount) {
+    VmScope scope;
+    HostClass* host = checked<HostClass>(clazz, "RegisterNatives on a non-class");
+    for (jint i = 0; i < methodCount; i++) {
+        if (!methods[i].fnPtr || methods[i].signature[0] != '(') {
+            return JNI_ERR;
+        }
+        HostVm::instance().registerNative(host->name, methods[i]);
+    }
+    return JNI_OK;
+}
+
+jobject _JNIEnv::NewGlobalRef(jobject object) {
+    VmScope scope;
+    // a global reference only has to keep the object alive
+    HostVm::instance().keep(object);
+    return object;
+}
+
+void _JNIEnv::DeleteGlobalRef(jobject globalRef) {
+    // kept objects live as long as the VM
+}
+
+void _JNIEnv::DeleteLocalRef(jobject localRef) {
+    // objects live until the next collect(), references or not
+}
+
+jboolean _JNIEnv::ExceptionCheck() {
+    return JNI_FALSE;
+}
+
+void _JNIEnv::ExceptionClear() {
+}
+
+jint _JavaVM::GetEnv(void** env, jint version) {
+    *env = HostVm::instance().env();
+    return JNI_OK;
+}
+
+jstring _JNIEnv::NewString(const jchar* unicodeChars, jsize length) {
+    VmScope scope;
+    HostString* string = HostVm::instance().adopt(new HostString());
+    string->units.assign((const char16_t*) unicodeChars, (size_t) length);
+    return string;
+}
+
+jsize _JNIEnv::GetStringLength(jstring string) {
+    return (jsize) HostVm::utf16(string).size();
+}
+
+void _JNIEnv::GetStringRegion(jstring string, jsize start, jsize length, jchar* buffer) {
+    const std::u16string& units = HostVm::utf16(string);
+    if (start < 0 || length < 0 || (size_t) start + (size_t) length > units.size()) {
+        jniFatal("string region out of bounds");
+    }
+    memcpy(buffer, units.data() + start, (size_t) length * sizeof(jchar));
+}
+
+jstring _JNIEnv::NewStringUTF(const char* bytes) {
+    VmScope scope;
+    if (!bytes) {
+        return nullptr;
+    }
+    // decoded as standard UTF-8, which modified UTF-8 agrees with for
+    // everything but NUL and supplementary characters
+    const size_t length = strlen(bytes);
+    std::vector<uint16_t> units(length);
+    units.resize(utf8ToUtf16(bytes, length, units.data()));
+    return NewString(units.data(), (jsize) units.size());
+}
+
+jsize _JNIEnv::GetStringUTFLength(jstring string) {
+    return (jsize) HostVm::utf(string).size();
+}
+
+const char* _JNIEnv::GetStringUTFChars(jstring string, jboolean* isCopy) {
+    VmScope scope;
+    if (isCopy) {
+        *isCopy = JNI_FALSE;
+    }
+    return HostVm::utf(string).c_str();
+}
+
+void _JNIEnv::ReleaseStringUTFChars(jstring string, const char* utf) {
+}
+
+jsize _JNIEnv::GetArrayLength(jarray array) {
+    if (HostObjectArray* objects = dynamic_cast<HostObjectArray*>(array)) {
+        return (jsize) objects->elements.size();
+    } else if (HostIntArray* ints = dynamic_cast<HostIntArray*>(array)) {
+        return (jsize) ints->elements.size();
+    } else if (HostLongArray* longs = dynamic_cast<HostLongArray*>(array)) {
+        return (jsize) longs->elements.size();
+    } else if (HostFloatArray* floats = dynamic_cast<HostFloatArray*>(array)) {
+        return (jsize) floats->elements.size();
+    }
+    jniFatal("GetArrayLength of a non-array");
+    return 0;
+}
+
+jobjectArray _JNIEnv::NewObjectArray(jsize length, jclass elementClass, jobject initialElement) {
+    VmScope scope;
+    HostObjectArray* array = newArray<HostObjectArray>(length);
+    std::fill(array->elements.begin(), array->elements.end(), initialElement);
+    return array;
+}
+
+jobject _JNIEnv::GetObjectArrayElement(jobjectArray array, jsize index) {
+    HostObjectArray* host = checked<HostObjectArray>(array, "not an object array");
+    checkRegion(host, index, 1);
+    return host->elements[index];
+}
+
+void _JNIEnv::SetObjectArrayElement(jobjectArray array, jsize index, jobject value) {
+    HostObjectArray* host = checked<HostObjectArray>(array, "not an object array");
+    checkRegion(host, index, 1);
+    host->elements[index] = value;
+}
+
+jintArray _JNIEnv::NewIntArray(jsize length) {
+    VmScope scope;
+    return newArray<HostIntArray>(length);
+}
+
+jlongArray _JNIEnv::NewLongArray(jsize length) {
+    VmScope scope;
+    return newArray<HostLongArray>(length);
+}
+
+jfloatArray _JNIEnv::NewFloatArray(jsize length) {
+    VmScope scope;
+    return newArray<HostFloatArray>(length);
+}
+
+void _JNIEnv::GetIntArrayRegion(jintArray array, jsize start, jsize length, jint* buffer) {
+    getRegion<HostIntArray>(array, start, length, buffer);
+}
+
+void _JNIEnv::GetLongArrayRegion(jlongArray array, jsize start, jsize length, jlong* buffer) {
+    getRegion<HostLongArray>(array, start, length, buffer);
+}
+
+void _JNIEnv::GetFloatArrayRegion(jfloatArray array, jsize start, jsize length, jfloat* buffer) {
+    getRegion<HostFloatArray>(array, start, length, buffer);
+}
+
+void _JNIEnv::SetIntArrayRegion(jintArray array, jsize start, jsize length, const jint* buffer) {
+    setRegion<HostIntArray>(array, start, length, buffer);
+}
+
+void _JNIEnv::SetLongArrayRegion(jlongArray array, jsize start, jsize length, const jlong* buffer) {
+    setRegion<HostLongArray>(array, start, length, buffer);
+}
+
+void _JNIEnv::SetFloatArrayRegion(jfloatArray array, jsize start, jsize length, const jfloat* buffer) {
+    setRegion<HostFloatArray>(array, start, length, buffer);
+}
+
+void* _JNIEnv::GetPrimitiveArrayCritical(jarray array, jboolean* isCopy) {
+    if (isCopy) {
+        *isCopy = JNI_FALSE;
+    }
+    if (HostIntArray* ints = dynamic_cast<HostIntArray*>(array)) {
+        return ints->elements.data();
+    } else if (HostLongArray* longs = dynamic_cast<HostLongArray*>(array)) {
+        return longs->elements.data();
+    } else if (HostFloatArray* floats = dynamic_cast<HostFloatArray*>(array)) {
+        return floats->elements.data();
+    }
+    jniFatal("GetPrimitiveArrayCritical of a non-primitive array");
+    return nullptr;
+}
+
+void _JNIEnv::ReleasePrimitiveArrayCritical(jarray array, void* carray, jint mode) {
+}
+
+jobject _JNIEnv::NewDirectByteBuffer(void* address, jlong capacity) {
+    VmScope scope;
+    HostDirectBuffer* buffer = HostVm::instance().adopt(new HostDirectBuffer());
+    buffer->address = address;
+    buffer->capacity = capacity;
+    return buffer;
+}
+
+void* _JNIEnv::GetDirectBufferAddress(jobject buffer) {
+    HostDirectBuffer* direct = dynamic_cast<HostDirectBuffer*>(buffer);
+    return direct ? direct->address : nullptr;
+}
+
+jlong _JNIEnv::GetDirectBufferCapacity(jobject buffer) {
+    HostDirectBuffer* direct = dynamic_cast<HostDirectBuffer*>(buffer);
+    return direct ? direct->capacity : -1;
+}
+
+static int sMinLogPriority = ANDROID_LOG_WARN;
+
+void hostLogSetMinPriority(int prio) {
+    sMinLogPriority = prio;
+}
+
+extern "C" int __android_log_print(int prio, const char* tag, const char* fmt, ...) {
+    if (prio < sMinLogPriority) {
+        return 0;
+    }
+    static const char kPriorityLetters[] = "??VDIWEFS";
+    fprintf(stderr, "%c/%s: ", kPriorityLetters[std::min(prio, (int) ANDROID_LOG_SILENT)], tag);
+    va_list args;
+    va_start(args, fmt);
+    int written = vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+    return written;
+}
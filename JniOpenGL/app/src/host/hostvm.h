@@ -0,0 +1,94 @@
+#ifndef JNIDEMO_HOSTVM_H
+#define JNIDEMO_HOSTVM_H
+
+#include <jni.h>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * A minimal in-process Java VM for running the JNI entry points on the host.
+ *
+ * Objects the native code creates through JNIEnv (strings, arrays, direct
+ * buffers) are real heap objects owned by the VM.  Like garbage, they stay
+ * alive until collect() runs, except those passed to keep().  The VM is not
+ * thread safe: JNI calls must all come from one thread, as they do in the
+ * library, whose worker threads never touch JNI.
+ */
+class HostVm {
+public:
+    /**
+     * @return the process-wide VM
+     */
+    static HostVm& instance();
+
+    JNIEnv* env() { return &mEnv; }
+
+    JavaVM* vm() { return &mVm; }
+
+    /**
+     * @return the function RegisterNatives bound to a method, or nullptr
+     */
+    void* registeredNative(const char* className, const char* name, const char* signature) const;
+
+    /**
+     * Records a RegisterNatives binding
+     */
+    void registerNative(const std::string& className, const JNINativeMethod& method);
+
+    /**
+     * Exempts an object from collect(), as a global reference would
+     */
+    void keep(jobject object);
+
+    /**
+     * Frees every object not passed to keep()
+     */
+    void collect();
+
+    /**
+     * @return number of objects currently alive
+     */
+    size_t liveObjects() const { return mHeap.size(); }
+
+    /**
+     * @return contents of a string as standard UTF-8
+     */
+    static const std::string& utf(jstring string);
+
+    /**
+     * @return contents of a string as the UTF-16 Java sees
+     */
+    static const std::u16string& utf16(jstring string);
+
+    /**
+     * @return true while the calling thread is inside a JNIEnv method.  Lets
+     *         allocation counters tell the VM's allocations from the library's.
+     */
+    static bool inVm();
+
+    /**
+     * Takes ownership of a new object
+     */
+    template<typename T>
+    T* adopt(T* object) {
+        mHeap.push_back(std::unique_ptr<_jobject>(object));
+        return object;
+    }
+
+private:
+    HostVm() {}
+
+    JNIEnv mEnv;
+    JavaVM mVm;
+    /**
+     * "class.name signature" to function
+     */
+    std::map<std::string, void*> mNatives;
+    std::vector<std::unique_ptr<_jobject>> mHeap;
+    std::vector<std::unique_ptr<_jobject>> mKept;
+};
+
+#endif //JNIDEMO_HOSTVM_H
@@ -0,0 +1,30 @@
+#ifndef JNIDEMO_HOST_ANDROID_LOG_H
+#define JNIDEMO_HOST_ANDROID_LOG_H
+
+/**
+ * Stand-in for the NDK's android/log.h when building for the host.  Messages
+ * at or above the minimum priority go to stderr; the rest are dropped, so
+ * chatty debug logging doesn't skew benchmarks.
+ */
+
+typedef enum android_LogPriority {
+    ANDROID_LOG_UNKNOWN = 0,
+    ANDROID_LOG_DEFAULT,
+    ANDROID_LOG_VERBOSE,
+    ANDROID_LOG_DEBUG,
+    ANDROID_LOG_INFO,
+    ANDROID_LOG_WARN,
+    ANDROID_LOG_ERROR,
+    ANDROID_LOG_FATAL,
+    ANDROID_LOG_SILENT,
+} android_LogPriority;
+
+extern "C" int __android_log_print(int prio, const char* tag, const char* fmt, ...)
+        __attribute__ ((format(printf, 3, 4)));
+
+/**
+ * Sets the lowest priority printed; ANDROID_LOG_WARN by default
+ */
+void hostLogSetMinPriority(int prio);
+
+#endif //JNIDEMO_HOST_ANDROID_LOG_H
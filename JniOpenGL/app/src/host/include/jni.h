@@ -0,0 +1,111 @@
+#ifndef JNIDEMO_HOST_JNI_H
+#define JNIDEMO_HOST_JNI_H
+
+/**
+ * Stand-in for the NDK's jni.h when building the native sources for the
+ * host.  It declares the types the NDK does and just the JNIEnv methods the
+ * library uses, backed by the in-process fake VM in hostvm.cpp, so the JNI
+ * entry points can be called straight from a host program.
+ */
+
+#include <cstdint>
+
+typedef uint8_t jboolean;
+typedef int8_t jbyte;
+typedef uint16_t jchar;
+typedef int16_t jshort;
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef float jfloat;
+typedef double jdouble;
+typedef jint jsize;
+
+class _jobject {
+public:
+    virtual ~_jobject() {}
+};
+class _jclass : public _jobject {};
+class _jstring : public _jobject {};
+class _jarray : public _jobject {};
+class _jobjectArray : public _jarray {};
+class _jintArray : public _jarray {};
+class _jlongArray : public _jarray {};
+class _jfloatArray : public _jarray {};
+
+typedef _jobject* jobject;
+typedef _jclass* jclass;
+typedef _jstring* jstring;
+typedef _jarray* jarray;
+typedef _jobjectArray* jobjectArray;
+typedef _jintArray* jintArray;
+typedef _jlongArray* jlongArray;
+typedef _jfloatArray* jfloatArray;
+
+#define JNI_FALSE 0
+#define JNI_TRUE 1
+
+#define JNI_OK 0
+#define JNI_ERR (-1)
+
+#define JNI_COMMIT 1
+#define JNI_ABORT 2
+
+#define JNI_VERSION_1_6 0x00010006
+
+typedef struct {
+    const char* name;
+    const char* signature;
+    void* fnPtr;
+} JNINativeMethod;
+
+#define JNIEXPORT __attribute__ ((visibility ("default")))
+#define JNICALL
+
+struct _JNIEnv {
+    jclass FindClass(const char* name);
+    jint RegisterNatives(jclass clazz, const JNINativeMethod* methods, jint methodCount);
+    jobject NewGlobalRef(jobject object);
+    void DeleteGlobalRef(jobject globalRef);
+    void DeleteLocalRef(jobject localRef);
+    jboolean ExceptionCheck();
+    void ExceptionClear();
+
+    jstring NewString(const jchar* unicodeChars, jsize length);
+    jsize GetStringLength(jstring string);
+    void GetStringRegion(jstring string, jsize start, jsize length, jchar* buffer);
+    jstring NewStringUTF(const char* bytes);
+    jsize GetStringUTFLength(jstring string);
+    const char* GetStringUTFChars(jstring string, jboolean* isCopy);
+    void ReleaseStringUTFChars(jstring string, const char* utf);
+
+    jsize GetArrayLength(jarray array);
+    jobjectArray NewObjectArray(jsize length, jclass elementClass, jobject initialElement);
+    jobject GetObjectArrayElement(jobjectArray array, jsize index);
+    void SetObjectArrayElement(jobjectArray array, jsize index, jobject value);
+
+    jintArray NewIntArray(jsize length);
+    jlongArray NewLongArray(jsize length);
+    jfloatArray NewFloatArray(jsize length);
+    void GetIntArrayRegion(jintArray array, jsize start, jsize length, jint* buffer);
+    void GetLongArrayRegion(jlongArray array, jsize start, jsize length, jlong* buffer);
+    void GetFloatArrayRegion(jfloatArray array, jsize start, jsize length, jfloat* buffer);
+    void SetIntArrayRegion(jintArray array, jsize start, jsize length, const jint* buffer);
+    void SetLongArrayRegion(jlongArray array, jsize start, jsize length, const jlong* buffer);
+    void SetFloatArrayRegion(jfloatArray array, jsize start, jsize length, const jfloat* buffer);
+    void* GetPrimitiveArrayCritical(jarray array, jboolean* isCopy);
+    void ReleasePrimitiveArrayCritical(jarray array, void* carray, jint mode);
+
+    jobject NewDirectByteBuffer(void* address, jlong capacity);
+    void* GetDirectBufferAddress(jobject buffer);
+    jlong GetDirectBufferCapacity(jobject buffer);
+};
+
+typedef _JNIEnv JNIEnv;
+
+struct _JavaVM {
+    jint GetEnv(void** env, jint version);
+};
+
+typedef _JavaVM JavaVM;
+
+#endif //JNIDEMO_HOST_JNI_H
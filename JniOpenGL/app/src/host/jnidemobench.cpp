@@ -0,0 +1,563 @@
+/**
+ * Host benchmarks for the strings and render JNI paths, and for recording
+ * and replaying command lists.
+ *
+ * Loads the library through JNI_OnLoad and calls the natives it registers,
+ * against the fake VM in hostvm.cpp and the headless GlRecorder backend,
+ * and prints the results as JSON so they can be compared between builds:
+ *
+ *   jnidemo-bench [--quick] [--output results.json]
+ *
+ * Allocation counts are heap allocations made by the library itself
+ * (operator new on any thread), excluding those of the fake VM, which on a
+ * device would be Java objects rather than native allocations.
+ */
+
+#include "commandlist.h"
+#include "glrecorder.h"
+#include "hostvm.h"
+#include "jnibridge.h"
+#include "workerpool.h"
+#include <jni.h>
+#include <android/log.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved);
+
+/**
+ * The JniHooks natives the benchmarks call, as JNI_OnLoad registered them
+ */
+struct Hooks {
+    jstring (*randomString)(JNIEnv*, jobject);
+    jobjectArray (*randomStrings)(JNIEnv*, jobject, jint);
+    jstring (*seededPhrase)(JNIEnv*, jobject, jlong, jlong);
+    jint (*randomPhrasesToBuffer)(JNIEnv*, jobject, jobject, jintArray, jint);
+    jint (*seededPhrasesToBuffer)(JNIEnv*, jobject, jobject, jintArray, jlong, jlong, jint);
+    jobjectArray (*uniqueStrings)(JNIEnv*, jobject, jlong, jlong, jint);
+    jboolean (*glInit)(JNIEnv*, jobject);
+    void (*glResize)(JNIEnv*, jobject, jint, jint);
+    void (*glSetInstanceCount)(JNIEnv*, jobject, jint);
+    void (*glStepFrame)(JNIEnv*, jobject);
+};
+
+static Hooks sHooks;
+
+/**
+ * Looks up a registered native, as the VM would when Java calls it
+ * @return false if it wasn't registered
+ */
+template<typename Function>
+static bool bindHook(Function& function, const char* name, const char* signature) {
+    function = (Function) HostVm::instance().registeredNative(JNIDEMO_HOOKS_CLASS, name, signature);
+    if (!function) {
+        fprintf(stderr, "native %s %s was not registered\n", name, signature);
+    }
+    return function != nullptr;
+}
+
+static bool loadLibrary() {
+    if (JNI_OnLoad(HostVm::instance().vm(), nullptr) != JNI_VERSION_1_6) {
+        fprintf(stderr, "JNI_OnLoad failed\n");
+        return false;
+    }
+    bool bound = bindHook(sHooks.randomString, "randomString", "()Ljava/lang/String;");
+    bound &= bindHook(sHooks.randomStrings, "randomStrings", "(I)[Ljava/lang/String;");
+    bound &= bindHook(sHooks.seededPhrase, "seededPhrase", "(JJ)Ljava/lang/String;");
+    bound &= bindHook(sHooks.randomPhrasesToBuffer, "randomPhrasesToBuffer", "(Ljava/nio/ByteBuffer;[II)I");
+    bound &= bindHook(sHooks.seededPhrasesToBuffer, "seededPhrasesToBuffer", "(Ljava/nio/ByteBuffer;[IJJI)I");
+    bound &= bindHook(sHooks.uniqueStrings, "uniqueStrings", "(JJI)[Ljava/lang/String;");
+    bound &= bindHook(sHooks.glInit, "glInit", "()Z");
+    bound &= bindHook(sHooks.glResize, "glResize", "(II)V");
+    bound &= bindHook(sHooks.glSetInstanceCount, "glSetInstanceCount", "(I)V");
+    bound &= bindHook(sHooks.glStepFrame, "glStepFrame", "()V");
+    return bound;
+}
+
+static std::atomic<uint64_t> sAllocations(0);
+
+static void* countedAllocation(size_t size) {
+    if (!HostVm::inVm()) {
+        sAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    void* memory = malloc(size ? size : 1);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new(size_t size) {
+    return countedAllocation(size);
+}
+
+void* operator new[](size_t size) {
+    return countedAllocation(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocation(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocation(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    free(memory);
+}
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double secondsSince(BenchClock::time_point start) {
+    return std::chrono::duration<double>(BenchClock::now() - start).count();
+}
+
+/**
+ * Collects results and writes them out as one JSON document
+ */
+class JsonReport {
+public:
+    void beginSection(const char* name) {
+        mJson += mSections++ ? ",\n  \"" : "  \"";
+        mJson += name;
+        mJson += "\": [";
+        mEntries = 0;
+    }
+
+    void endSection() {
+        mJson += "\n  ]";
+    }
+
+    void beginEntry(const char* name) {
+        mJson += mEntries++ ? ",\n    {" : "\n    {";
+        mJson += "\"name\": \"";
+        mJson += name;
+        mJson += "\"";
+    }
+
+    void field(const char* name, double value) {
+        char text[64];
+        snprintf(text, sizeof(text), ", \"%s\": %.6g", name, value);
+        mJson += text;
+    }
+
+    void endEntry() {
+        mJson += "}";
+    }
+
+    std::string finish(bool quick) const {
+        char header[128];
+        snprintf(header, sizeof(header), "{\n  \"quick\": %s,\n  \"threads\": %zu,\n",
+                 quick ? "true" : "false", WorkerPool::shared().concurrency());
+        return header + mJson + "\n}\n";
+    }
+
+private:
+    std::string mJson;
+    int mSections = 0;
+    int mEntries = 0;
+};
+
+/**
+ * Times one strings path and reports its throughput and allocations
+ * @param run generates a batch of phrases and returns how many it made
+ */
+template<typename Run>
+static void benchStrings(JsonReport& report, const char* name, uint64_t targetPhrases, Run run) {
+    HostVm& vm = HostVm::instance();
+    // warm up thread-local buffers and the worker pool
+    run();
+    vm.collect();
+
+    uint64_t phrases = 0;
+    uint64_t allocations = 0;
+    double seconds = 0;
+    while (phrases < targetPhrases) {
+        uint64_t allocationsBefore = sAllocations.load();
+        BenchClock::time_point start = BenchClock::now();
+        phrases += run();
+        seconds += secondsSince(start);
+        allocations += sAllocations.load() - allocationsBefore;
+        // the "GC" runs outside the timed region
+        vm.collect();
+    }
+    report.beginEntry(name);
+    report.field("phrases", (double) phrases);
+    report.field("seconds", seconds);
+    report.field("phrasesPerSecond", phrases / seconds);
+    report.field("allocationsPerPhrase", (double) allocations / phrases);
+    report.endEntry();
+    fprintf(stderr, "%-24s %12.0f phrases/s %8.3f allocations/phrase\n", name, phrases / seconds,
+            (double) allocations / phrases);
+}
+
+static void runStringBenchmarks(JsonReport& report, bool quick) {
+    HostVm& vm = HostVm::instance();
+    JNIEnv* env = vm.env();
+    const uint64_t scale = quick ? 1 : 10;
+
+    report.beginSection("strings");
+    benchStrings(report, "randomString", 50000 * scale, [&]() -> uint64_t {
+        for (int i = 0; i < 1000; i++) {
+            sHooks.randomString(env, nullptr);
+        }
+        return 1000;
+    });
+    benchStrings(report, "randomStrings", 100000 * scale, [&]() -> uint64_t {
+        sHooks.randomStrings(env, nullptr, 1000);
+        return 1000;
+    });
+    benchStrings(report, "seededPhrase", 50000 * scale, [&]() -> uint64_t {
+        // one row at a time, as a list binding rows does
+        static jlong index = 0;
+        for (int i = 0; i < 1000; i++) {
+            sHooks.seededPhrase(env, nullptr, 0x5eed, index++);
+        }
+        return 1000;
+    });
+    benchStrings(report, "uniqueStrings", 100000 * scale, [&]() -> uint64_t {
+        static jlong position = 0;
+        sHooks.uniqueStrings(env, nullptr, 7, position, 1000);
+        position = (position + 1000) % 50000;
+        return 1000;
+    });
+
+    const jint bufferPhrases = 1 << 16;
+    std::vector<char> bytes((size_t) bufferPhrases * 64);
+    jobject buffer = env->NewDirectByteBuffer(bytes.data(), (jlong) bytes.size());
+    jintArray table = env->NewIntArray(2 * bufferPhrases);
+    vm.keep(buffer);
+    vm.keep(table);
+    benchStrings(report, "randomPhrasesToBuffer", 1000000 * scale, [&]() -> uint64_t {
+        return (uint64_t) sHooks.randomPhrasesToBuffer(
+                env, nullptr, buffer, table, bufferPhrases);
+    });
+    benchStrings(report, "seededPhrasesToBuffer", 1000000 * scale, [&]() -> uint64_t {
+        static jlong first = 0;
+        jint written = sHooks.seededPhrasesToBuffer(
+                env, nullptr, buffer, table, 0x5eed, first, bufferPhrases);
+        first += written;
+        return (uint64_t) written;
+    });
+    report.endSection();
+}
+
+/**
+ * Renders frames through glStepFrame and reports CPU time, GL calls and
+ * allocations per frame
+ * @param instances instanced triangles to draw, or 0 for the classic single triangle
+ */
+static void benchFrames(JsonReport& report, GlRecorder& recorder, const char* name, jint instances, int frames) {
+    JNIEnv* env = HostVm::instance().env();
+    sHooks.glSetInstanceCount(env, nullptr, instances);
+    // let the uniform and streaming rings fill and the instance data settle
+    for (int i = 0; i < 8; i++) {
+        sHooks.glStepFrame(env, nullptr);
+    }
+
+    std::vector<double> frameMillis;
+    frameMillis.reserve((size_t) frames);
+    uint64_t calls = 0;
+    uint64_t allocations = 0;
+    for (int i = 0; i < frames; i++) {
+        uint64_t allocationsBefore = sAllocations.load();
+        recorder.beginFrame();
+        sHooks.glStepFrame(env, nullptr);
+        const GlFrameStats& stats = recorder.endFrame();
+        allocations += sAllocations.load() - allocationsBefore;
+        frameMillis.push_back(stats.cpuMillis);
+        calls += stats.totalCalls;
+    }
+    std::sort(frameMillis.begin(), frameMillis.end());
+    double total = 0;
+    for (double millis : frameMillis) {
+        total += millis;
+    }
+    report.beginEntry(name);
+    report.field("instances", instances);
+    report.field("frames", frames);
+    report.field("frameCpuMeanMs", total / frames);
+    report.field("frameCpuP50Ms", frameMillis[frameMillis.size() / 2]);
+    report.field("frameCpuP99Ms", frameMillis[frameMillis.size() * 99 / 100]);
+    report.field("glCallsPerFrame", (double) calls / frames);
+    report.field("allocationsPerFrame", (double) allocations / frames);
+    report.endEntry();
+    fprintf(stderr, "%-24s %12.4f ms/frame %8.1f GL calls/frame %8.3f allocations/frame\n", name,
+            total / frames, (double) calls / frames, (double) allocations / frames);
+}
+
+/**
+ * Lists recorded per frame by the command list benchmark, one per worker task
+ */
+static const size_t kCommandLists = 16;
+static const int kDrawsPerList = 64;
+/**
+ * Small enough that every list spans several arena blocks
+ */
+static const size_t kListBlockBytes = 1024;
+/**
+ * Bytes each list writes into its slice of the shared buffer; bigger than a
+ * block, so every list also records an oversized command
+ */
+static const GLsizeiptr kListWriteBytes = 4096;
+/**
+ * Program list i uses, so the replay order can be read back from the calls
+ */
+static const GLuint kFirstListProgram = 1000;
+
+/**
+ * Records list index of a frame: its program, a write filling its slice of
+ * buffer, then kDrawsPerList uniform updates and instanced draws
+ */
+static void recordCommandList(CommandList& list, size_t index, GLuint buffer, int frame) {
+    list.reset();
+    list.useProgram(kFirstListProgram + (GLuint) index);
+    list.bindBuffer(GL_ARRAY_BUFFER, buffer);
+    void* slice = list.writeBuffer(GL_ARRAY_BUFFER, (GLintptr) index * kListWriteBytes, kListWriteBytes);
+    memset(slice, (int) ((index + frame) & 0xff), (size_t) kListWriteBytes);
+    for (int draw = 0; draw < kDrawsPerList; draw++) {
+        list.setUniform(0, glm::vec4((float) index, (float) draw, (float) frame, 1.0f));
+        list.setUniform(1, glm::mat4((float) draw));
+        list.drawArraysInstanced(GL_TRIANGLES, 0, 3, draw + 1);
+    }
+}
+
+/**
+ * Checks the calls captured for one replayed frame: the worker lists in
+ * reverse recording order, as their sort keys ask, then the two main thread
+ * lists that share a key, in the order they were submitted
+ * @return false, after saying why, if any call is missing, extra or out of place
+ */
+static bool checkCommandReplay(const GlRecorder& recorder, GLuint buffer, int frame) {
+    const std::vector<GlCall>& calls = recorder.frameCalls();
+    size_t next = 0;
+    auto expect = [&](GlFunction function, int arg, int64_t value) -> const GlCall* {
+        if (next >= calls.size() || calls[next].function != function
+            || (arg >= 0 && calls[next].args[arg].i != value)) {
+            fprintf(stderr, "command list replay: call %zu of frame %d is not %s(%lld) as recorded\n",
+                    next, frame, glFunctionName(function), (long long) value);
+            return nullptr;
+        }
+        return &calls[next++];
+    };
+
+    for (size_t position = 0; position < kCommandLists; position++) {
+        const size_t index = kCommandLists - 1 - position;
+        if (!expect(GlFn_UseProgram, 0, kFirstListProgram + index)
+            || !expect(GlFn_BindBuffer, 1, buffer)
+            || !expect(GlFn_BufferSubData, 1, (int64_t) index * kListWriteBytes)) {
+            return false;
+        }
+        for (int draw = 0; draw < kDrawsPerList; draw++) {
+            const GlCall* uniform = expect(GlFn_Uniform4fv, 0, 0);
+            if (!uniform) {
+                return false;
+            }
+            // the value was copied into the list's arena when it was recorded
+            const GLfloat* value = (const GLfloat*) uniform->args[2].p;
+            if (value[0] != (float) index || value[1] != (float) draw || value[2] != (float) frame) {
+                fprintf(stderr, "command list replay: list %zu draw %d of frame %d replayed the wrong uniform\n",
+                        index, draw, frame);
+                return false;
+            }
+            if (!expect(GlFn_UniformMatrix4fv, 0, 1) || !expect(GlFn_DrawArraysInstanced, 3, draw + 1)) {
+                return false;
+            }
+        }
+    }
+    if (!expect(GlFn_DrawArrays, 2, 1) || !expect(GlFn_DrawArrays, 2, 2)) {
+        return false;
+    }
+    if (next != calls.size()) {
+        fprintf(stderr, "command list replay: frame %d made %zu calls, %zu were recorded\n",
+                frame, calls.size(), next);
+        return false;
+    }
+
+    const std::vector<uint8_t>* contents = recorder.bufferContents(buffer);
+    for (size_t index = 0; index < kCommandLists; index++) {
+        const uint8_t expected = (uint8_t) ((index + frame) & 0xff);
+        for (GLsizeiptr i = 0; i < kListWriteBytes; i++) {
+            if (!contents || (*contents)[index * kListWriteBytes + i] != expected) {
+                fprintf(stderr, "command list replay: list %zu of frame %d wrote the wrong buffer contents\n",
+                        index, frame);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Records kCommandLists lists per frame on the worker pool, replays them
+ * through a CommandQueue and reports CPU time, GL calls and allocations per
+ * frame.  The first frame and one after the timed ones are checked call by
+ * call against what was recorded.
+ * @return false if a checked frame didn't replay as recorded
+ */
+static bool benchCommandLists(JsonReport& report, GlRecorder& recorder, int frames) {
+    GLuint buffer = 0;
+    gGl.GenBuffers(1, &buffer);
+    gGl.BindBuffer(GL_ARRAY_BUFFER, buffer);
+    gGl.BufferData(GL_ARRAY_BUFFER, kListWriteBytes * (GLsizeiptr) kCommandLists, nullptr, GL_DYNAMIC_DRAW);
+
+    std::vector<std::unique_ptr<CommandList>> lists;
+    for (size_t i = 0; i < kCommandLists; i++) {
+        lists.emplace_back(new CommandList(kListBlockBytes));
+    }
+    CommandList first(kListBlockBytes);
+    CommandList second(kListBlockBytes);
+    CommandQueue queue;
+
+    int frame = 0;
+    // built once, so running it on the pool doesn't allocate every frame
+    const std::function<void(size_t)> recordList = [&](size_t index) {
+        recordCommandList(*lists[index], index, buffer, frame);
+        queue.submit(lists[index].get(), kCommandLists - 1 - index);
+    };
+    // records and replays one frame, returning the CPU time the recording took
+    auto runFrame = [&]() -> double {
+        BenchClock::time_point start = BenchClock::now();
+        WorkerPool::shared().run(kCommandLists, recordList);
+        // both after every worker list, and sharing a key: submission order decides
+        first.reset();
+        first.drawArrays(GL_POINTS, 0, 1);
+        queue.submit(&first, kCommandLists);
+        second.reset();
+        second.drawArrays(GL_POINTS, 0, 2);
+        queue.submit(&second, kCommandLists);
+        const double recordMillis = secondsSince(start) * 1000;
+
+        recorder.beginFrame();
+        queue.replay();
+        recorder.endFrame();
+        return recordMillis;
+    };
+    auto checkedFrame = [&]() -> bool {
+        recorder.setCaptureArguments(true);
+        runFrame();
+        bool replayed = checkCommandReplay(recorder, buffer, frame);
+        recorder.setCaptureArguments(false);
+        frame++;
+        return replayed;
+    };
+
+    // the first frame also grows every list's arena
+    if (!checkedFrame()) {
+        return false;
+    }
+    double recordMillis = 0;
+    double replayMillis = 0;
+    uint64_t calls = 0;
+    uint64_t allocations = 0;
+    for (int i = 0; i < frames; i++, frame++) {
+        uint64_t allocationsBefore = sAllocations.load();
+        recordMillis += runFrame();
+        allocations += sAllocations.load() - allocationsBefore;
+        replayMillis += recorder.lastFrame().cpuMillis;
+        calls += recorder.lastFrame().totalCalls;
+    }
+    // and the reused arenas still replay exactly what was recorded
+    if (!checkedFrame()) {
+        return false;
+    }
+
+    const char* name = "commandLists";
+    report.beginEntry(name);
+    report.field("lists", (double) kCommandLists + 2);
+    report.field("frames", frames);
+    report.field("recordCpuMeanMs", recordMillis / frames);
+    report.field("replayCpuMeanMs", replayMillis / frames);
+    report.field("glCallsPerFrame", (double) calls / frames);
+    report.field("allocationsPerFrame", (double) allocations / frames);
+    report.endEntry();
+    fprintf(stderr, "%-24s %12.4f ms/frame %8.1f GL calls/frame %8.3f allocations/frame\n", name,
+            (recordMillis + replayMillis) / frames, (double) calls / frames, (double) allocations / frames);
+    return true;
+}
+
+static bool runRenderBenchmarks(JsonReport& report, bool quick) {
+    JNIEnv* env = HostVm::instance().env();
+    GlRecorder recorder;
+    recorder.install();
+    if (!sHooks.glInit(env, nullptr)) {
+        fprintf(stderr, "glInit failed\n");
+        return false;
+    }
+    sHooks.glResize(env, nullptr, 1080, 1920);
+
+    const int frames = quick ? 200 : 2000;
+    report.beginSection("render");
+    benchFrames(report, recorder, "classic", 0, frames);
+    benchFrames(report, recorder, "instanced-1000", 1000, frames);
+    benchFrames(report, recorder, "instanced-10000", 10000, frames / 4);
+    bool replayed = benchCommandLists(report, recorder, frames);
+    report.endSection();
+    return replayed;
+}
+
+int main(int argc, char** argv) {
+    bool quick = false;
+    const char* outputPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--quick")) {
+            quick = true;
+        } else if (!strcmp(argv[i], "--output") && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--quick] [--output results.json]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (!loadLibrary()) {
+        return 1;
+    }
+    JsonReport report;
+    runStringBenchmarks(report, quick);
+    if (!runRenderBenchmarks(report, quick)) {
+        return 1;
+    }
+
+    const std::string json = report.finish(quick);
+    FILE* output = outputPath ? fopen(outputPath, "w") : stdout;
+    if (!output) {
+        fprintf(stderr, "could not write %s\n", outputPath);
+        return 1;
+    }
+    fputs(json.c_str(), output);
+    if (output != stdout) {
+        fclose(output);
+    }
+    return 0;
+}
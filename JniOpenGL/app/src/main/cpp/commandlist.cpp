@@ -0,0 +1,326 @@
+#include "commandlist.h"
+#include "glm/gtc/type_ptr.hpp"
+#include <algorithm>
+#include <cstring>
+
+/**
+ * Every recordable command
+ */
+enum CommandType : uint16_t {
+    kCmdUseProgram,
+    kCmdBindVertexArray,
+    kCmdBindBuffer,
+    kCmdBindBufferRange,
+    kCmdUniform1i,
+    kCmdUniform1f,
+    kCmdUniform2f,
+    kCmdUniform3f,
+    kCmdUniform4f,
+    kCmdUniformMatrix4f,
+    kCmdWriteBuffer,
+    kCmdDrawArrays,
+    kCmdDrawArraysInstanced,
+};
+
+/**
+ * Precedes every command's arguments in the arena
+ */
+struct CommandHeader {
+    uint16_t type;
+    uint16_t reserved;
+    /**
+     * bytes from this header to the next one
+     */
+    uint32_t size;
+};
+
+/**
+ * Commands are padded to this so every header and argument struct is aligned
+ */
+static const size_t kCommandAlignment = 8;
+static_assert(sizeof(CommandHeader) % kCommandAlignment == 0, "arguments must start aligned");
+
+// argument layouts, one per command type
+
+struct BindArgs {
+    GLenum target;
+    GLuint name;
+};
+
+struct BindRangeArgs {
+    GLenum target;
+    GLuint index;
+    GLuint buffer;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+/**
+ * followed by the value bytes
+ */
+struct UniformArgs {
+    GLint location;
+};
+
+/**
+ * followed by size bytes of data, padded
+ */
+struct WriteBufferArgs {
+    GLenum target;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+struct DrawArgs {
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei instanceCount;
+};
+
+static inline size_t alignUp(size_t bytes) {
+    return (bytes + kCommandAlignment - 1) & ~(kCommandAlignment - 1);
+}
+
+/**
+ * @return offset of the inline data following an argument struct
+ */
+template<typename Args>
+static inline size_t inlineOffset() {
+    return alignUp(sizeof(Args));
+}
+
+CommandList::CommandList(size_t blockBytes) :
+        mBlockBytes(std::max(blockBytes, alignUp(sizeof(CommandHeader) + 64))),
+        mCurrentBlock(0),
+        mCommandCount(0),
+        mBytesUsed(0) {
+}
+
+void CommandList::reset() {
+    for (Block& block : mBlocks) {
+        block.used = 0;
+    }
+    mCurrentBlock = 0;
+    mCommandCount = 0;
+    mBytesUsed = 0;
+}
+
+void* CommandList::allocate(uint16_t type, size_t payloadBytes) {
+    const size_t needed = sizeof(CommandHeader) + alignUp(payloadBytes);
+    if (mBlocks.empty() || mBlocks[mCurrentBlock].used + needed > mBlocks[mCurrentBlock].capacity) {
+        if (!mBlocks.empty() && mBlocks[mCurrentBlock].used > 0) {
+            mCurrentBlock++;
+        }
+        if (mCurrentBlock == mBlocks.size()) {
+            mBlocks.push_back(Block());
+        }
+        Block& block = mBlocks[mCurrentBlock];
+        if (block.capacity < needed) {
+            // oversized commands get a block of their own, which is kept for reuse
+            block.capacity = std::max(mBlockBytes, needed);
+            block.data.reset(new uint8_t[block.capacity]);
+        }
+        block.used = 0;
+    }
+    Block& block = mBlocks[mCurrentBlock];
+    CommandHeader* header = (CommandHeader*) (block.data.get() + block.used);
+    header->type = type;
+    header->reserved = 0;
+    header->size = (uint32_t) needed;
+    block.used += needed;
+    mBytesUsed += needed;
+    mCommandCount++;
+    return header + 1;
+}
+
+void CommandList::useProgram(GLuint program) {
+    BindArgs* args = (BindArgs*) allocate(kCmdUseProgram, sizeof(BindArgs));
+    args->target = 0;
+    args->name = program;
+}
+
+void CommandList::bindVertexArray(GLuint array) {
+    BindArgs* args = (BindArgs*) allocate(kCmdBindVertexArray, sizeof(BindArgs));
+    args->target = 0;
+    args->name = array;
+}
+
+void CommandList::bindBuffer(GLenum target, GLuint buffer) {
+    BindArgs* args = (BindArgs*) allocate(kCmdBindBuffer, sizeof(BindArgs));
+    args->target = target;
+    args->name = buffer;
+}
+
+void CommandList::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    BindRangeArgs* args = (BindRangeArgs*) allocate(kCmdBindBufferRange, sizeof(BindRangeArgs));
+    args->target = target;
+    args->index = index;
+    args->buffer = buffer;
+    args->offset = offset;
+    args->size = size;
+}
+
+void CommandList::setUniform(GLint location, uint16_t type, const void* value, size_t bytes) {
+    if (location < 0) {
+        return;
+    }
+    uint8_t* payload = (uint8_t*) allocate(type, inlineOffset<UniformArgs>() + bytes);
+    ((UniformArgs*) payload)->location = location;
+    memcpy(payload + inlineOffset<UniformArgs>(), value, bytes);
+}
+
+void CommandList::setUniform(GLint location, GLint value) {
+    setUniform(location, kCmdUniform1i, &value, sizeof(value));
+}
+
+void CommandList::setUniform(GLint location, GLfloat value) {
+    setUniform(location, kCmdUniform1f, &value, sizeof(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::vec2& value) {
+    setUniform(location, kCmdUniform2f, glm::value_ptr(value), sizeof(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::vec3& value) {
+    setUniform(location, kCmdUniform3f, glm::value_ptr(value), sizeof(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::vec4& value) {
+    setUniform(location, kCmdUniform4f, glm::value_ptr(value), sizeof(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::mat4& value) {
+    setUniform(location, kCmdUniformMatrix4f, glm::value_ptr(value), sizeof(value));
+}
+
+void* CommandList::writeBuffer(GLenum target, GLintptr offset, GLsizeiptr size) {
+    uint8_t* payload = (uint8_t*) allocate(kCmdWriteBuffer, inlineOffset<WriteBufferArgs>() + (size_t) size);
+    WriteBufferArgs* args = (WriteBufferArgs*) payload;
+    args->target = target;
+    args->offset = offset;
+    args->size = size;
+    return payload + inlineOffset<WriteBufferArgs>();
+}
+
+void CommandList::writeBuffer(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    memcpy(writeBuffer(target, offset, size), data, (size_t) size);
+}
+
+void CommandList::drawArrays(GLenum mode, GLint first, GLsizei count) {
+    DrawArgs* args = (DrawArgs*) allocate(kCmdDrawArrays, sizeof(DrawArgs));
+    args->mode = mode;
+    args->first = first;
+    args->count = count;
+    args->instanceCount = 1;
+}
+
+void CommandList::drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount) {
+    DrawArgs* args = (DrawArgs*) allocate(kCmdDrawArraysInstanced, sizeof(DrawArgs));
+    args->mode = mode;
+    args->first = first;
+    args->count = count;
+    args->instanceCount = instanceCount;
+}
+
+/**
+ * Issues one recorded command
+ * @param type the command's CommandType
+ * @param payload the command's arguments
+ */
+static void replayCommand(uint16_t type, const uint8_t* payload) {
+    const GLfloat* uniformValues = (const GLfloat*) (payload + inlineOffset<UniformArgs>());
+    switch (type) {
+        case kCmdUseProgram:
+            gGl.UseProgram(((const BindArgs*) payload)->name);
+            break;
+        case kCmdBindVertexArray:
+            gGl.BindVertexArray(((const BindArgs*) payload)->name);
+            break;
+        case kCmdBindBuffer: {
+            const BindArgs* args = (const BindArgs*) payload;
+            gGl.BindBuffer(args->target, args->name);
+            break;
+        }
+        case kCmdBindBufferRange: {
+            const BindRangeArgs* args = (const BindRangeArgs*) payload;
+            gGl.BindBufferRange(args->target, args->index, args->buffer, args->offset, args->size);
+            break;
+        }
+        case kCmdUniform1i:
+            gGl.Uniform1iv(((const UniformArgs*) payload)->location, 1, (const GLint*) uniformValues);
+            break;
+        case kCmdUniform1f:
+            gGl.Uniform1fv(((const UniformArgs*) payload)->location, 1, uniformValues);
+            break;
+        case kCmdUniform2f:
+            gGl.Uniform2fv(((const UniformArgs*) payload)->location, 1, uniformValues);
+            break;
+        case kCmdUniform3f:
+            gGl.Uniform3fv(((const UniformArgs*) payload)->location, 1, uniformValues);
+            break;
+        case kCmdUniform4f:
+            gGl.Uniform4fv(((const UniformArgs*) payload)->location, 1, uniformValues);
+            break;
+        case kCmdUniformMatrix4f:
+            gGl.UniformMatrix4fv(((const UniformArgs*) payload)->location, 1, GL_FALSE, uniformValues);
+            break;
+        case kCmdWriteBuffer: {
+            const WriteBufferArgs* args = (const WriteBufferArgs*) payload;
+            gGl.BufferSubData(args->target, args->offset, args->size, payload + inlineOffset<WriteBufferArgs>());
+            break;
+        }
+        case kCmdDrawArrays: {
+            const DrawArgs* args = (const DrawArgs*) payload;
+            gGl.DrawArrays(args->mode, args->first, args->count);
+            break;
+        }
+        case kCmdDrawArraysInstanced: {
+            const DrawArgs* args = (const DrawArgs*) payload;
+            gGl.DrawArraysInstanced(args->mode, args->first, args->count, args->instanceCount);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void CommandList::replay() const {
+    for (size_t i = 0; i < mBlocks.size() && i <= mCurrentBlock; i++) {
+        const Block& block = mBlocks[i];
+        size_t position = 0;
+        while (position < block.used) {
+            const CommandHeader* header = (const CommandHeader*) (block.data.get() + position);
+            replayCommand(header->type, (const uint8_t*) (header + 1));
+            position += header->size;
+        }
+    }
+}
+
+void CommandQueue::submit(const CommandList* list, uint64_t sortKey) {
+    std::lock_guard<std::mutex> lock(mLock);
+    Submission submission;
+    submission.sortKey = sortKey;
+    submission.sequence = mSequence++;
+    submission.list = list;
+    mSubmissions.push_back(submission);
+}
+
+size_t CommandQueue::replay() {
+    {
+        // take the submissions so workers can queue the next frame while we replay this one
+        std::lock_guard<std::mutex> lock(mLock);
+        mReplaying.swap(mSubmissions);
+        mSubmissions.clear();
+    }
+    std::sort(mReplaying.begin(), mReplaying.end(), [](const Submission& a, const Submission& b) {
+        return a.sortKey != b.sortKey ? a.sortKey < b.sortKey : a.sequence < b.sequence;
+    });
+    size_t commands = 0;
+    for (const Submission& submission : mReplaying) {
+        submission.list->replay();
+        commands += submission.list->commandCount();
+    }
+    mReplaying.clear();
+    return commands;
+}
@@ -0,0 +1,147 @@
+#ifndef JNIDEMO_COMMANDLIST_H
+#define JNIDEMO_COMMANDLIST_H
+
+#include "gldispatch.h"
+#include "glm/glm.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Deferred GL commands, recorded on any thread and replayed on the GL thread.
+ *
+ * Commands are packed back to back into large arena blocks: a small header
+ * followed by the command's arguments, with uniform values and buffer
+ * contents copied inline.  Recording never calls GL and allocates only when
+ * the arena needs another block; reset() keeps the blocks, so a list reused
+ * every frame stops allocating after the first few frames.
+ *
+ * A single CommandList must only be used by one thread at a time: give each
+ * worker its own list and hand the finished lists to a CommandQueue.
+ */
+class CommandList {
+public:
+    /**
+     * @param blockBytes size of each arena block; bigger buffer writes get a block of their own
+     */
+    explicit CommandList(size_t blockBytes = 16 * 1024);
+
+    CommandList(const CommandList&) = delete;
+    CommandList& operator=(const CommandList&) = delete;
+
+    /**
+     * Forgets every recorded command, keeping the arena for reuse
+     */
+    void reset();
+
+    // Binding commands
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint array);
+    void bindBuffer(GLenum target, GLuint buffer);
+    void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+    // Uniform updates for the program current at replay time.  Locations
+    // below zero are ignored, as with glUniform*.
+    void setUniform(GLint location, GLint value);
+    void setUniform(GLint location, GLfloat value);
+    void setUniform(GLint location, const glm::vec2& value);
+    void setUniform(GLint location, const glm::vec3& value);
+    void setUniform(GLint location, const glm::vec4& value);
+    void setUniform(GLint location, const glm::mat4& value);
+
+    /**
+     * Records a glBufferSubData to the buffer bound to target at replay time
+     * @return where to write the size bytes of data, inside the list's arena;
+     *         valid until reset()
+     */
+    void* writeBuffer(GLenum target, GLintptr offset, GLsizeiptr size);
+
+    /**
+     * Records a glBufferSubData, copying size bytes from data now
+     */
+    void writeBuffer(GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+
+    // Draw commands
+    void drawArrays(GLenum mode, GLint first, GLsizei count);
+    void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
+
+    /**
+     * Issues the recorded commands, in recording order.  Must be called on the GL thread.
+     */
+    void replay() const;
+
+    size_t commandCount() const { return mCommandCount; }
+
+    /**
+     * @return arena bytes used by the recorded commands
+     */
+    size_t bytesUsed() const { return mBytesUsed; }
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity;
+        size_t used;
+    };
+
+    /**
+     * Reserves space for one command and fills in its header
+     * @param type a CommandType
+     * @param payloadBytes size of the command's arguments and inline data
+     * @return where the arguments go
+     */
+    void* allocate(uint16_t type, size_t payloadBytes);
+
+    void setUniform(GLint location, uint16_t type, const void* value, size_t bytes);
+
+    size_t mBlockBytes;
+    std::vector<Block> mBlocks;
+    /**
+     * index of the block currently being recorded into
+     */
+    size_t mCurrentBlock;
+    size_t mCommandCount;
+    size_t mBytesUsed;
+};
+
+/**
+ * Collects finished command lists from any number of threads and replays
+ * them on the GL thread, ordered by sort key.  Lists with equal keys replay
+ * in the order they were submitted.
+ */
+class CommandQueue {
+public:
+    /**
+     * Queues a list for the next replay().  The list must stay alive and
+     * unmodified until then.  Safe to call from any thread.
+     * @param list recorded commands
+     * @param sortKey replay position relative to other lists, lowest first,
+     *                e.g. render pass in the high bits and material in the low bits
+     */
+    void submit(const CommandList* list, uint64_t sortKey = 0);
+
+    /**
+     * Replays and dequeues every submitted list.  Must be called on the GL thread.
+     * @return number of commands replayed
+     */
+    size_t replay();
+
+private:
+    struct Submission {
+        uint64_t sortKey;
+        uint64_t sequence;
+        const CommandList* list;
+    };
+
+    std::mutex mLock;
+    std::vector<Submission> mSubmissions;
+    /**
+     * replay's working copy of mSubmissions, kept to avoid reallocating every frame
+     */
+    std::vector<Submission> mReplaying;
+    uint64_t mSequence = 0;
+};
+
+#endif //JNIDEMO_COMMANDLIST_H
@@ -0,0 +1,242 @@
+#include "corpusfile.h"
+#include "textencoding.h"
+#include <android/log.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#define  LOG_TAG    "corpusfile"
+#define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+/**
+ * "JDWC" -- jnidemo word corpus
+ */
+static const uint32_t kCorpusMagic = 0x4357444a;
+/**
+ * Bump whenever the file layout changes
+ */
+static const uint32_t kCorpusVersion = 1;
+static const uint32_t kCorpusListCount = 3;
+
+/**
+ * Where one word list lives in the file
+ */
+struct CorpusFileList {
+    uint32_t wordCount;
+    uint32_t maxLength;
+    uint64_t indexOffset;
+    uint64_t bytesOffset;
+    uint64_t bytesLength;
+};
+
+struct CorpusFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t listCount;
+    uint32_t reserved;
+    CorpusFileList lists[kCorpusListCount];
+};
+static_assert(sizeof(CorpusFileList) == 32, "corpus list header must not contain padding");
+static_assert(sizeof(CorpusFileHeader) == 112, "corpus header must not contain padding");
+
+/**
+ * @return true if [offset, offset + length) lies within a file of fileLength bytes
+ */
+static bool withinFile(uint64_t offset, uint64_t length, uint64_t fileLength) {
+    return offset <= fileLength && length <= fileLength - offset;
+}
+
+/**
+ * Checks one list's header against the file and, if it is sound, points list at the mapped data
+ */
+static bool mapWordList(const CorpusFileList& entry, const uint8_t* file, uint64_t fileLength, WordList& list) {
+    const uint64_t indexLength = ((uint64_t) entry.wordCount + 1) * sizeof(uint32_t);
+    if (entry.wordCount == 0
+        || entry.indexOffset % sizeof(uint32_t) != 0
+        || !withinFile(entry.indexOffset, indexLength, fileLength)
+        || !withinFile(entry.bytesOffset, entry.bytesLength, fileLength)
+        || entry.bytesLength > UINT32_MAX
+        // phrase buffers are sized from maxLength, so no word may claim more than the list holds
+        || entry.maxLength > entry.bytesLength) {
+        return false;
+    }
+    list.words = nullptr;
+    list.count = entry.wordCount;
+    list.maxLength = entry.maxLength;
+    list.offsets = (const uint32_t*) (file + entry.indexOffset);
+    list.bytes = (const char*) (file + entry.bytesOffset);
+    list.bytesLength = (uint32_t) entry.bytesLength;
+    // filled in after mapping if the list isn't ASCII
+    list.units = nullptr;
+    list.unitOffsets = nullptr;
+    // individual offsets are checked as words are read, see WordList::operator[]
+    return true;
+}
+
+MappedCorpus::MappedCorpus() :
+        mMapping(nullptr),
+        mMappingLength(0),
+        mCorpus() {
+}
+
+MappedCorpus::~MappedCorpus() {
+    close();
+}
+
+bool MappedCorpus::open(const char* path) {
+    close();
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOGE("could not open corpus %s: %s", path, strerror(errno));
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || (uint64_t) status.st_size < sizeof(CorpusFileHeader)) {
+        LOGE("corpus %s is too short", path);
+        ::close(fd);
+        return false;
+    }
+    const size_t length = (size_t) status.st_size;
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file alive on its own
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        LOGE("could not map corpus %s: %s", path, strerror(errno));
+        return false;
+    }
+    // phrases sample words all over the file; don't read ahead around each one
+    madvise(mapping, length, MADV_RANDOM);
+
+    const uint8_t* file = (const uint8_t*) mapping;
+    CorpusFileHeader header;
+    memcpy(&header, file, sizeof(header));
+    PhraseCorpus corpus;
+    bool valid = header.magic == kCorpusMagic
+                 && header.version == kCorpusVersion
+                 && header.listCount == kCorpusListCount
+                 && mapWordList(header.lists[0], file, length, corpus.adjective1)
+                 && mapWordList(header.lists[1], file, length, corpus.adjective2)
+                 && mapWordList(header.lists[2], file, length, corpus.animal);
+    if (!valid) {
+        LOGE("%s is not a valid corpus file", path);
+        munmap(mapping, length);
+        return false;
+    }
+    mMapping = mapping;
+    mMappingLength = length;
+    mCorpus = corpus;
+    encodeUtf16(mCorpus.adjective1, 0);
+    encodeUtf16(mCorpus.adjective2, 1);
+    encodeUtf16(mCorpus.animal, 2);
+    LOGI("mapped corpus %s: %u + %u + %u words", path, corpus.adjective1.count, corpus.adjective2.count,
+         corpus.animal.count);
+    return true;
+}
+
+void MappedCorpus::encodeUtf16(WordList& list, size_t slot) {
+    if (isAscii(list.bytes, list.bytesLength)) {
+        return;
+    }
+    std::vector<uint16_t>& units = mUnits[slot];
+    std::vector<uint32_t>& unitOffsets = mUnitOffsets[slot];
+    // UTF-16 never takes more units than UTF-8 takes bytes, so the string
+    // block's size is a good first guess; words may share bytes, though
+    units.resize(list.bytesLength);
+    unitOffsets.resize((size_t) list.count + 1);
+    uint32_t position = 0;
+    for (uint32_t i = 0; i < list.count; i++) {
+        CorpusWord word = list[i];
+        if (units.size() - position < word.length) {
+            units.resize(std::max<size_t>(units.size() * 2, position + word.length));
+        }
+        unitOffsets[i] = position;
+        position += (uint32_t) utf8ToUtf16(word.text, word.length, units.data() + position);
+    }
+    unitOffsets[list.count] = position;
+    units.resize(position);
+    units.shrink_to_fit();
+    list.units = units.data();
+    list.unitOffsets = unitOffsets.data();
+}
+
+void MappedCorpus::close() {
+    if (mMapping) {
+        munmap(mMapping, mMappingLength);
+    }
+    mMapping = nullptr;
+    mMappingLength = 0;
+    mCorpus = PhraseCorpus();
+    for (size_t slot = 0; slot < kCorpusListCount; slot++) {
+        std::vector<uint16_t>().swap(mUnits[slot]);
+        std::vector<uint32_t>().swap(mUnitOffsets[slot]);
+    }
+}
+
+bool writeCorpusFile(const char* path, const PhraseCorpus& corpus) {
+    const WordList* lists[kCorpusListCount] = {&corpus.adjective1, &corpus.adjective2, &corpus.animal};
+
+    // lay out every index first, then every string block
+    CorpusFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = kCorpusMagic;
+    header.version = kCorpusVersion;
+    header.listCount = kCorpusListCount;
+    uint64_t position = sizeof(header);
+    std::vector<std::vector<uint32_t>> indexes(kCorpusListCount);
+    for (uint32_t l = 0; l < kCorpusListCount; l++) {
+        const WordList& list = *lists[l];
+        CorpusFileList& entry = header.lists[l];
+        entry.wordCount = list.count;
+        entry.indexOffset = position;
+        position += ((uint64_t) list.count + 1) * sizeof(uint32_t);
+        uint32_t offset = 0;
+        indexes[l].reserve(list.count + 1);
+        for (uint32_t i = 0; i < list.count; i++) {
+            indexes[l].push_back(offset);
+            uint32_t length = list[i].length;
+            offset += length;
+            entry.maxLength = length > entry.maxLength ? length : entry.maxLength;
+        }
+        indexes[l].push_back(offset);
+        entry.bytesLength = offset;
+    }
+    for (uint32_t l = 0; l < kCorpusListCount; l++) {
+        header.lists[l].bytesOffset = position;
+        position += header.lists[l].bytesLength;
+    }
+
+    // write to a temporary file and rename it into place, so a reader never
+    // maps a half-written corpus
+    const std::string temporaryPath = std::string(path) + ".tmp";
+    FILE* file = fopen(temporaryPath.c_str(), "wb");
+    if (!file) {
+        LOGE("could not write %s: %s", temporaryPath.c_str(), strerror(errno));
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (uint32_t l = 0; ok && l < kCorpusListCount; l++) {
+        ok = fwrite(indexes[l].data(), sizeof(uint32_t), indexes[l].size(), file) == indexes[l].size();
+    }
+    for (uint32_t l = 0; ok && l < kCorpusListCount; l++) {
+        const WordList& list = *lists[l];
+        for (uint32_t i = 0; ok && i < list.count; i++) {
+            CorpusWord word = list[i];
+            ok = fwrite(word.text, 1, word.length, file) == word.length;
+        }
+    }
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(temporaryPath.c_str(), path) != 0) {
+        LOGE("could not write corpus %s", path);
+        unlink(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
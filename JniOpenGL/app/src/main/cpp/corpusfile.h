@@ -0,0 +1,78 @@
+#ifndef JNIDEMO_CORPUSFILE_H
+#define JNIDEMO_CORPUSFILE_H
+
+#include "phrasecorpus.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A phrase corpus read from a binary corpus file with mmap.
+ *
+ * File layout, all integers little endian:
+ *   header:  magic "JDWC", version, list count (3), reserved, then for each
+ *            of adjective1, adjective2 and animal: word count, longest word
+ *            length, file offset of its index, file offset and length of its
+ *            string bytes
+ *   index:   per list, word count + 1 uint32 offsets into its string bytes;
+ *            word i spans [offset[i], offset[i + 1])
+ *   strings: per list, the words' UTF-8 bytes packed back to back, unterminated
+ *
+ * Opening a corpus only checks the header and that the indexes and string
+ * blocks lie within the file, plus a SIMD scan that the string bytes are
+ * ASCII; no word is otherwise read until a phrase uses it, so even
+ * multi-million word corpora open quickly and only the pages that are
+ * actually sampled stay loaded.  A list with non-ASCII words is decoded to
+ * UTF-16 once at open instead, so phrases can still be built directly in
+ * the form Java strings use.
+ */
+class MappedCorpus {
+public:
+    MappedCorpus();
+    ~MappedCorpus();
+
+    MappedCorpus(const MappedCorpus&) = delete;
+    MappedCorpus& operator=(const MappedCorpus&) = delete;
+
+    /**
+     * Maps a corpus file, replacing any corpus opened before
+     * @param path corpus file to map
+     * @return false if the file can't be mapped or isn't a valid corpus file
+     */
+    bool open(const char* path);
+
+    /**
+     * Unmaps the file.  Any PhraseCorpus obtained from corpus() becomes invalid.
+     */
+    void close();
+
+    bool isOpen() const { return mMapping != nullptr; }
+
+    /**
+     * @return the mapped corpus, which can be used wherever builtinCorpus() can
+     */
+    const PhraseCorpus& corpus() const { return mCorpus; }
+
+private:
+    /**
+     * Builds the UTF-16 form of a list that isn't pure ASCII
+     */
+    void encodeUtf16(WordList& list, size_t slot);
+
+    void* mMapping;
+    size_t mMappingLength;
+    PhraseCorpus mCorpus;
+    // UTF-16 forms of the non-ASCII lists, see WordList::units
+    std::vector<uint16_t> mUnits[3];
+    std::vector<uint32_t> mUnitOffsets[3];
+};
+
+/**
+ * Writes a corpus in the format MappedCorpus reads
+ * @param path file to create or replace
+ * @param corpus words to write, e.g. builtinCorpus()
+ * @return false if the file couldn't be written
+ */
+bool writeCorpusFile(const char* path, const PhraseCorpus& corpus);
+
+#endif //JNIDEMO_CORPUSFILE_H
@@ -0,0 +1,130 @@
+#include "framestats.h"
+#include <algorithm>
+
+FrameStats gFrameStats;
+
+FrameStats::FrameStats() {
+    reset();
+}
+
+void FrameStats::reset() {
+    mFrameCount.store(0, std::memory_order_relaxed);
+    mTotalMicros.store(0, std::memory_order_relaxed);
+    mMaxNanos.store(0, std::memory_order_relaxed);
+    for (auto& bucket : mHistogram) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    for (auto& frame : mRecent) {
+        frame.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * Buckets 0-3 hold 0-3us exactly.  Above that, each power of two [2^o, 2^(o+1))
+ * is split into four equal buckets, starting at bucket 4 for [4, 8).
+ */
+size_t FrameStats::bucketFor(uint64_t micros) {
+    if (micros < 4) {
+        return (size_t) micros;
+    }
+    size_t octave = 63 - (size_t) __builtin_clzll(micros);
+    size_t quarter = (size_t) (micros >> (octave - 2)) & 3;
+    return std::min(octave * 4 + quarter - 4, kHistogramBuckets - 1);
+}
+
+/**
+ * @return the inclusive lower bound of a bucket, in microseconds
+ */
+static uint64_t bucketLowerMicros(size_t bucket) {
+    if (bucket < 4) {
+        return bucket;
+    }
+    size_t octave = bucket / 4 + 1;
+    size_t quarter = bucket % 4;
+    return (uint64_t) (4 + quarter) << (octave - 2);
+}
+
+float FrameStats::bucketUpperMs(size_t bucket) {
+    return (float) bucketLowerMicros(bucket + 1) / 1000.0f;
+}
+
+float FrameStats::bucketMidMs(size_t bucket) {
+    return (float) (bucketLowerMicros(bucket) + bucketLowerMicros(bucket + 1)) / 2000.0f;
+}
+
+void FrameStats::record(uint64_t frameNanos) {
+    uint64_t micros = frameNanos / 1000;
+    uint64_t index = mFrameCount.load(std::memory_order_relaxed);
+    mRecent[index & (kWindow - 1)].store((uint32_t) std::min<uint64_t>(micros, UINT32_MAX),
+                                         std::memory_order_relaxed);
+    mHistogram[bucketFor(micros)].fetch_add(1, std::memory_order_relaxed);
+    mTotalMicros.fetch_add(micros, std::memory_order_relaxed);
+    if (frameNanos > mMaxNanos.load(std::memory_order_relaxed)) {
+        mMaxNanos.store(frameNanos, std::memory_order_relaxed);
+    }
+    // publishes the slot written above to readers
+    mFrameCount.store(index + 1, std::memory_order_release);
+}
+
+FrameStatsSummary FrameStats::summary() const {
+    FrameStatsSummary result;
+    uint64_t counts[kHistogramBuckets];
+    result.frameCount = mFrameCount.load(std::memory_order_acquire);
+    uint64_t histogramTotal = 0;
+    for (size_t i = 0; i < kHistogramBuckets; i++) {
+        counts[i] = mHistogram[i].load(std::memory_order_relaxed);
+        histogramTotal += counts[i];
+    }
+    result.meanMs = result.frameCount
+                    ? (float) mTotalMicros.load(std::memory_order_relaxed) / 1000.0f / (float) result.frameCount
+                    : 0.0f;
+    result.maxMs = (float) mMaxNanos.load(std::memory_order_relaxed) / 1.0e6f;
+
+    // walk the histogram once, picking off each percentile as we pass it
+    const float percentiles[] = {0.50f, 0.95f, 0.99f};
+    float* outputs[] = {&result.p50Ms, &result.p95Ms, &result.p99Ms};
+    size_t next = 0;
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < kHistogramBuckets && next < 3; i++) {
+        cumulative += counts[i];
+        while (next < 3 && histogramTotal && (float) cumulative >= percentiles[next] * (float) histogramTotal) {
+            // never report more than the exact max we know about
+            *outputs[next] = std::min(bucketMidMs(i), result.maxMs);
+            next++;
+        }
+    }
+    for (; next < 3; next++) {
+        *outputs[next] = 0.0f;
+    }
+    return result;
+}
+
+size_t FrameStats::histogram(uint64_t* counts, size_t capacity) const {
+    size_t n = std::min(capacity, kHistogramBuckets);
+    for (size_t i = 0; i < n; i++) {
+        counts[i] = mHistogram[i].load(std::memory_order_relaxed);
+    }
+    return n;
+}
+
+size_t FrameStats::recentFrames(uint32_t* frameMicros, size_t capacity) const {
+    uint64_t end = mFrameCount.load(std::memory_order_acquire);
+    uint64_t available = std::min<uint64_t>(std::min<uint64_t>(end, kWindow), capacity);
+    uint64_t begin = end - available;
+    for (uint64_t i = begin; i < end; i++) {
+        frameMicros[i - begin] = mRecent[i & (kWindow - 1)].load(std::memory_order_relaxed);
+    }
+    // frames the writer lapped while we were copying are no longer trustworthy.
+    // record() overwrites slot latest before publishing latest + 1, so that
+    // in-flight write counts too: it may already have replaced frame latest - kWindow
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t latest = mFrameCount.load(std::memory_order_relaxed);
+    uint64_t firstValid = latest + 1 > kWindow ? latest + 1 - kWindow : 0;
+    if (firstValid > begin) {
+        uint64_t dropped = std::min(firstValid - begin, available);
+        std::copy(frameMicros + dropped, frameMicros + available, frameMicros);
+        available -= dropped;
+    }
+    return (size_t) available;
+}
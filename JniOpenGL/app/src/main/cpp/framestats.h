@@ -0,0 +1,97 @@
+#ifndef JNIDEMO_FRAMESTATS_H
+#define JNIDEMO_FRAMESTATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Snapshot of frame timing, as returned by FrameStats::summary()
+ */
+struct FrameStatsSummary {
+    uint64_t frameCount;
+    float meanMs;
+    float p50Ms;
+    float p95Ms;
+    float p99Ms;
+    float maxMs;
+};
+
+/**
+ * Per-frame CPU time statistics.
+ *
+ * One thread (the GL thread) records frame times; any other thread can read
+ * them at the same time without locks.  Every frame lands in a ring buffer
+ * of the most recent kWindow frames, for frame pacing, and in a log-scale
+ * histogram with four buckets per power of two microseconds, from which the
+ * percentiles are estimated.  Bucket midpoints are reported, so percentiles
+ * are within 12.5% of the true value; the max is exact.
+ */
+class FrameStats {
+public:
+    /**
+     * Number of recent frames kept in the ring buffer; a power of two
+     */
+    static const size_t kWindow = 512;
+    /**
+     * Number of histogram buckets; the last one collects everything above ~1.8s
+     */
+    static const size_t kHistogramBuckets = 80;
+
+    FrameStats();
+
+    /**
+     * Adds one frame.  Must only be called from a single thread.
+     * @param frameNanos CPU time the frame took, in nanoseconds
+     */
+    void record(uint64_t frameNanos);
+
+    /**
+     * @return count, mean, p50/p95/p99 and max over every frame since the last reset()
+     */
+    FrameStatsSummary summary() const;
+
+    /**
+     * Copies the histogram
+     * @param counts receives up to kHistogramBuckets frame counts
+     * @param capacity number of entries counts can hold
+     * @return number of entries written
+     */
+    size_t histogram(uint64_t* counts, size_t capacity) const;
+
+    /**
+     * Copies the most recent frame times, oldest first
+     * @param frameMicros receives up to kWindow - 1 frame times in microseconds;
+     *                    the oldest slot is the next one record() overwrites, so it's never returned
+     * @param capacity number of entries frameMicros can hold
+     * @return number of entries written
+     */
+    size_t recentFrames(uint32_t* frameMicros, size_t capacity) const;
+
+    /**
+     * @return the exclusive upper bound of a histogram bucket, in milliseconds
+     */
+    static float bucketUpperMs(size_t bucket);
+
+    /**
+     * Forgets all recorded frames.  Like record(), only safe from the recording thread.
+     */
+    void reset();
+
+private:
+    static size_t bucketFor(uint64_t micros);
+    static float bucketMidMs(size_t bucket);
+
+    std::atomic<uint64_t> mFrameCount;
+    std::atomic<uint64_t> mTotalMicros;
+    std::atomic<uint64_t> mMaxNanos;
+    std::atomic<uint64_t> mHistogram[kHistogramBuckets];
+    std::atomic<uint32_t> mRecent[kWindow];
+};
+
+/**
+ * Timing of every glStepFrame
+ */
+extern FrameStats gFrameStats;
+
+#endif //JNIDEMO_FRAMESTATS_H
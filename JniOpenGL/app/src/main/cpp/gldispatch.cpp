@@ -0,0 +1,47 @@
+#include "gldispatch.h"
+
+#ifndef JNIDEMO_HEADLESS_GL
+/**
+ * Entry points of the GLES3 driver we link against.  This is a constant
+ * initializer, so no code runs for it when the library loads.
+ */
+static constexpr GlDispatch kNativeGlDispatch = {
+#define GL_DISPATCH_NATIVE(ret, name, params, args) gl##name,
+        GL_DISPATCH_FUNCTIONS(GL_DISPATCH_NATIVE)
+#undef GL_DISPATCH_NATIVE
+};
+
+GlDispatch gGl = kNativeGlDispatch;
+#else
+/**
+ * Headless builds have no driver to fall back on; a backend such as
+ * GlRecorder must be installed before any GL call is made.
+ */
+GlDispatch gGl = {};
+#endif
+
+static const char* const kGlFunctionNames[GlFn_Count] = {
+#define GL_DISPATCH_NAME(ret, name, params, args) "gl" #name,
+        GL_DISPATCH_FUNCTIONS(GL_DISPATCH_NAME)
+#undef GL_DISPATCH_NAME
+};
+
+const char* glFunctionName(GlFunction function) {
+    if (function < 0 || function >= GlFn_Count) {
+        return "gl<unknown>";
+    }
+    return kGlFunctionNames[function];
+}
+
+void installGlDispatch(const GlDispatch& table) {
+    gGl = table;
+}
+
+bool installNativeGlDispatch() {
+#ifndef JNIDEMO_HEADLESS_GL
+    gGl = kNativeGlDispatch;
+    return true;
+#else
+    return false;
+#endif
+}
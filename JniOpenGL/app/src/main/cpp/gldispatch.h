@@ -0,0 +1,113 @@
+#ifndef JNIDEMO_GLDISPATCH_H
+#define JNIDEMO_GLDISPATCH_H
+
+#include <GLES3/gl32.h>
+
+/**
+ * Every GL entry point the renderer is allowed to call, as
+ * X(return type, name without the gl prefix, parameter list, argument list).
+ * Adding a GL call to the renderer means adding it here first, so that
+ * both the native backend and the recording backend pick it up.
+ */
+#define GL_DISPATCH_FUNCTIONS(X) \
+    X(void, AttachShader, (GLuint program, GLuint shader), (program, shader)) \
+    X(void, BindBuffer, (GLenum target, GLuint buffer), (target, buffer)) \
+    X(void, BindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size)) \
+    X(void, BindVertexArray, (GLuint array), (array)) \
+    X(void, BufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage)) \
+    X(void, BufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data)) \
+    X(void, Clear, (GLbitfield mask), (mask)) \
+    X(void, ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha)) \
+    X(GLenum, ClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout)) \
+    X(void, CompileShader, (GLuint shader), (shader)) \
+    X(GLuint, CreateProgram, (), ()) \
+    X(GLuint, CreateShader, (GLenum type), (type)) \
+    X(void, DeleteBuffers, (GLsizei n, const GLuint* buffers), (n, buffers)) \
+    X(void, DeleteProgram, (GLuint program), (program)) \
+    X(void, DeleteShader, (GLuint shader), (shader)) \
+    X(void, DeleteSync, (GLsync sync), (sync)) \
+    X(void, DeleteVertexArrays, (GLsizei n, const GLuint* arrays), (n, arrays)) \
+    X(void, DetachShader, (GLuint program, GLuint shader), (program, shader)) \
+    X(void, DrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(void, DrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount)) \
+    X(void, EnableVertexAttribArray, (GLuint index), (index)) \
+    X(GLsync, FenceSync, (GLenum condition, GLbitfield flags), (condition, flags)) \
+    X(void, GenBuffers, (GLsizei n, GLuint* buffers), (n, buffers)) \
+    X(void, GenVertexArrays, (GLsizei n, GLuint* arrays), (n, arrays)) \
+    X(void, GetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name)) \
+    X(void, GetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name)) \
+    X(GLint, GetAttribLocation, (GLuint program, const GLchar* name), (program, name)) \
+    X(GLenum, GetError, (), ()) \
+    X(void, GetIntegerv, (GLenum pname, GLint* data), (pname, data)) \
+    X(void, GetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary), (program, bufSize, length, binaryFormat, binary)) \
+    X(void, GetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (program, bufSize, length, infoLog)) \
+    X(void, GetProgramiv, (GLuint program, GLenum pname, GLint* params), (program, pname, params)) \
+    X(void, GetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (shader, bufSize, length, infoLog)) \
+    X(void, GetShaderiv, (GLuint shader, GLenum pname, GLint* params), (shader, pname, params)) \
+    X(const GLubyte*, GetString, (GLenum name), (name)) \
+    X(GLuint, GetUniformBlockIndex, (GLuint program, const GLchar* uniformBlockName), (program, uniformBlockName)) \
+    X(GLint, GetUniformLocation, (GLuint program, const GLchar* name), (program, name)) \
+    X(void, LinkProgram, (GLuint program), (program)) \
+    X(void*, MapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access)) \
+    X(void, ProgramBinary, (GLuint program, GLenum binaryFormat, const void* binary, GLsizei length), (program, binaryFormat, binary, length)) \
+    X(void, ProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value)) \
+    X(void, ShaderSource, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length), (shader, count, string, length)) \
+    X(void, Uniform1fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value)) \
+    X(void, Uniform1iv, (GLint location, GLsizei count, const GLint* value), (location, count, value)) \
+    X(void, Uniform2fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value)) \
+    X(void, Uniform3fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value)) \
+    X(void, Uniform4fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value)) \
+    X(void, UniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding)) \
+    X(void, UniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value)) \
+    X(GLboolean, UnmapBuffer, (GLenum target), (target)) \
+    X(void, UseProgram, (GLuint program), (program)) \
+    X(void, VertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor)) \
+    X(void, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer), (index, size, type, normalized, stride, pointer)) \
+    X(void, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+
+/**
+ * Identifies one entry of GL_DISPATCH_FUNCTIONS, e.g. GlFn_DrawArrays
+ */
+enum GlFunction {
+#define GL_DISPATCH_ENUM(ret, name, params, args) GlFn_##name,
+    GL_DISPATCH_FUNCTIONS(GL_DISPATCH_ENUM)
+#undef GL_DISPATCH_ENUM
+    GlFn_Count
+};
+
+/**
+ * Table of GL entry points.  All renderer code calls GL through the global
+ * gGl table rather than through the GLES3 symbols directly, so the backend
+ * can be swapped (e.g. for the headless GlRecorder) without touching callers.
+ */
+struct GlDispatch {
+#define GL_DISPATCH_MEMBER(ret, name, params, args) ret (GL_APIENTRYP name) params;
+    GL_DISPATCH_FUNCTIONS(GL_DISPATCH_MEMBER)
+#undef GL_DISPATCH_MEMBER
+};
+
+/**
+ * The active GL backend.  On device this starts out pointing at the native
+ * GLES3 driver entry points.
+ */
+extern GlDispatch gGl;
+
+/**
+ * @param function a dispatch table entry
+ * @return the GL name of the function, e.g. "glDrawArrays"
+ */
+const char* glFunctionName(GlFunction function);
+
+/**
+ * Replaces the active GL backend
+ * @param table the entry points to route all GL calls through from now on
+ */
+void installGlDispatch(const GlDispatch& table);
+
+/**
+ * Routes GL calls back to the native GLES3 driver
+ * @return false if this build has no native backend (JNIDEMO_HEADLESS_GL), true otherwise
+ */
+bool installNativeGlDispatch();
+
+#endif //JNIDEMO_GLDISPATCH_H
@@ -1,23 +1,89 @@
 #include <GLES3/gl32.h>
 #include <GLES3/gl3ext.h>
+#include "framestats.h"
+#include "gldispatch.h"
+#include "instancedbatch.h"
+#include "jnibridge.h"
+#include "programcache.h"
+#include "shaderprogram.h"
+#include "streamingbuffer.h"
+#include "transformhierarchy.h"
+#include "uniformring.h"
 #include <jni.h>
 #include <android/log.h>
+#ifndef JNIDEMO_HEADLESS_GL
+#include <EGL/egl.h>
+#endif
 #include "glm/glm.hpp"
 #include "glm/gtc/matrix_transform.hpp" // glm::translate, glm::rotate, glm::scale
 #include "glm/gtc/type_ptr.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
 #include <chrono>
+#include <string>
 
 #define  LOG_TAG    "gles3jnidemo"
 #define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
 #define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
 
 /**
- * The OpenGL program ID for our shader
+ * Our linked shader program, with its uniforms and attributes reflected
  */
-GLuint gProgram;
+ShaderProgram gProgram;
+/**
+ * Program used to draw the triangle instanced, see gInstancedVertexShaderSource
+ */
+ShaderProgram gInstancedProgram;
+/**
+ * Draws gInstanceCount copies of the triangle with a single draw call when
+ * instancing is enabled
+ */
+InstancedBatch gInstancedBatch;
+/**
+ * Number of instances requested from the UI thread via glSetInstanceCount;
+ * zero selects the classic single-triangle path
+ */
+std::atomic<int> gRequestedInstanceCount(0);
+/**
+ * Per-frame constants shared by both programs, written once per frame into
+ * gUniformRing instead of as individual glUniform* calls per program
+ */
+FrameConstants gFrameConstants;
+UniformBufferRing gUniformRing;
+/**
+ * Ring that CPU-animated vertex data, e.g. gInstancedBatch's instances, is streamed through
+ */
+StreamingVertexBuffer gStreamingBuffer;
+/**
+ * Initial size of gStreamingBuffer: three frames of 16k instances
+ */
+static const GLsizeiptr kStreamingBufferBytes = 3 * 16384 * sizeof(InstancedBatch::InstanceVertex);
+/**
+ * Transforms of everything in the scene.  Only nodes whose transform changes
+ * have their world matrix recomputed each frame.
+ */
+TransformHierarchy gScene;
+/**
+ * gScene node the classic triangle hangs off, spinning under a static root
+ */
+int32_t gTriangleNode = TransformHierarchy::kNoParent;
+/**
+ * Maps our model space onto the viewport without stretching it to the surface's
+ * aspect ratio; rebuilt by resizeGraphics()
+ */
+glm::mat4 gProjectionMat = glm::mat4(1.0f);
+/**
+ * EGL context our GPU resources were created in; they're only valid while
+ * that context is alive
+ */
+void* gResourceContext = nullptr;
+/**
+ * true once initGraphics() has created all GPU resources in gResourceContext
+ */
+bool gGraphicsReady = false;
 /**
  * Vertex Buffer Object we'll use to upload data to the GPU
  */
@@ -33,22 +99,14 @@ GLuint gVaoID;
  * when rendering
  */
 auto t_start = std::chrono::high_resolution_clock::now();
-/**
- * ID for the active fragment shader
- */
-GLuint gFragmentShaderID;
-/**
- * ID for the active vertex shader
- */
-GLuint gVertexShaderID;
 
 static void printGLString(const char *name, GLenum s) {
-    const char *v = (const char *) glGetString(s);
+    const char *v = (const char *) gGl.GetString(s);
     LOGI("GL %s = %s\n", name, v);
 }
 
 static void checkGlError(const char* op) {
-    for (GLint error = glGetError(); error; error = glGetError()) {
+    for (GLint error = gGl.GetError(); error; error = gGl.GetError()) {
         LOGI("after %s() glError (0x%x)\n", op, error);
     }
 }
@@ -56,27 +114,57 @@ static void checkGlError(const char* op) {
 /**
  * Sets the gl_Position for each vertex to the uploaded vertex data's
  * X,Y coordinates, specifying 0 for Z since we're in 2D at the moment.
- * A transformation matrix is applied via the uniform u_transformationMat,
- * set by the client
+ * A transformation matrix is applied via u_transform from the FrameConstants
+ * block, set by the client
  */
-const char* gVertexShaderSource = R"glsl(#version 300 es
+const std::string gVertexShaderSource = withFrameConstants(R"glsl(#version 300 es
     in vec2 position;
-    uniform mat4 u_transformationMat;
     void main()
     {
-        gl_Position = u_transformationMat * vec4(position, 0.0, 1.0);
+        gl_Position = u_transform * vec4(position, 0.0, 1.0);
     }
-)glsl";
+)glsl");
+/**
+ * Sets the outColor output based on u_color from the FrameConstants block, set by client
+ */
+const std::string gFragmentShaderSource = withFrameConstants(R"glsl(#version 300 es
+        precision mediump float;
+        out vec4 outColor;
+        void main()
+        {
+            outColor = vec4(u_color, 1.0);
+        }
+)glsl");
+
 /**
- * Sets the outColor output based on uniform u_triangleColor, set by client
+ * Instanced variant of gVertexShaderSource.  Each instance supplies its own
+ * rotation/scale (i_transform.xy = (cos, sin) * scale), translation
+ * (i_transform.zw) and color, so thousands of triangles need one draw call.
+ * u_projection from the FrameConstants block corrects for the surface's aspect ratio.
  */
-const char* gFragmentShaderSource = R"glsl(#version 300 es
+const std::string gInstancedVertexShaderSource = withFrameConstants(R"glsl(#version 300 es
+    in vec2 position;
+    in vec4 i_transform;
+    in vec4 i_color;
+    out vec4 v_color;
+    void main()
+    {
+        vec2 rotated = vec2(i_transform.x * position.x - i_transform.y * position.y,
+                            i_transform.y * position.x + i_transform.x * position.y);
+        gl_Position = u_projection * vec4(rotated + i_transform.zw, 0.0, 1.0);
+        v_color = i_color;
+    }
+)glsl");
+/**
+ * Passes the per-instance color through
+ */
+const char* gInstancedFragmentShaderSource = R"glsl(#version 300 es
         precision mediump float;
-        uniform vec3 u_triangleColor;
+        in vec4 v_color;
         out vec4 outColor;
         void main()
         {
-            outColor = vec4(u_triangleColor, 1.0);
+            outColor = v_color;
         }
 )glsl";
 
@@ -87,24 +175,24 @@ const char* gFragmentShaderSource = R"glsl(#version 300 es
  * @return non-zero shader ID if successful, else zero
  */
 GLuint loadShader(GLenum shaderType, const char* pSource) {
-    GLuint shader = glCreateShader(shaderType);
+    GLuint shader = gGl.CreateShader(shaderType);
     if (shader) {
-        glShaderSource(shader, 1, &pSource, NULL);
-        glCompileShader(shader);
+        gGl.ShaderSource(shader, 1, &pSource, NULL);
+        gGl.CompileShader(shader);
         GLint compiled = 0;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        gGl.GetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
         if (!compiled) {
             GLint infoLen = 0;
-            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLen);
+            gGl.GetShaderiv(shader, GL_INFO_LOG_LENGTH, &infoLen);
             if (infoLen) {
                 char* buf = (char*) malloc(infoLen);
                 if (buf) {
-                    glGetShaderInfoLog(shader, infoLen, NULL, buf);
+                    gGl.GetShaderInfoLog(shader, infoLen, NULL, buf);
                     LOGE("Could not compile shader %d:\n%s\n",
                          shaderType, buf);
                     free(buf);
                 }
-                glDeleteShader(shader);
+                gGl.DeleteShader(shader);
                 shader = 0;
             }
         }
@@ -114,63 +202,140 @@ GLuint loadShader(GLenum shaderType, const char* pSource) {
 
 /**
  * Links the given vertex and fragment shaders together into a single shader program
+ * and enumerates its active uniforms and attributes.  A binary of the program is
+ * loaded from gProgramCache when available, and stored there after a fresh link.
  * @param pVertexSource raw source code for vertex shader
  * @param pFragmentSource raw source code for fragment shader
+ * @param reflection receives the linked program and its reflected variables
+ * @param cacheLabel name of the program's entry in the program binary cache
  * @return non-zero shader program ID if link is successful, else zero.
  */
-GLuint createProgram(const char* pVertexSource, const char* pFragmentSource) {
-    gVertexShaderID = loadShader(GL_VERTEX_SHADER, pVertexSource);
-    if (!gVertexShaderID) {
+GLuint createProgram(const char* pVertexSource, const char* pFragmentSource, ShaderProgram& reflection,
+                     const char* cacheLabel) {
+    // a cached binary skips compiling and linking altogether
+    GLuint cachedProgram = gProgramCache.load(cacheLabel, pVertexSource, pFragmentSource);
+    if (cachedProgram) {
+        reflection.reflect(cachedProgram);
+        return cachedProgram;
+    }
+
+    GLuint vertexShader = loadShader(GL_VERTEX_SHADER, pVertexSource);
+    if (!vertexShader) {
         return 0;
     }
 
-    gFragmentShaderID = loadShader(GL_FRAGMENT_SHADER, pFragmentSource);
-    if (!gFragmentShaderID) {
+    GLuint fragmentShader = loadShader(GL_FRAGMENT_SHADER, pFragmentSource);
+    if (!fragmentShader) {
+        gGl.DeleteShader(vertexShader);
         return 0;
     }
 
-    GLuint program = glCreateProgram();
+    GLuint program = gGl.CreateProgram();
     if (program) {
-        glAttachShader(program, gVertexShaderID);
+        gGl.AttachShader(program, vertexShader);
         checkGlError("glAttachShader");
-        glAttachShader(program, gFragmentShaderID);
+        gGl.AttachShader(program, fragmentShader);
         checkGlError("glAttachShader");
-        glLinkProgram(program);
+        // ask the driver to keep the binary around so we can cache it
+        gGl.ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        gGl.LinkProgram(program);
         GLint linkStatus = GL_FALSE;
-        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        gGl.GetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        // a linked program no longer needs its shaders, and a failed one won't be kept
+        gGl.DetachShader(program, vertexShader);
+        gGl.DetachShader(program, fragmentShader);
         if (linkStatus != GL_TRUE) {
             GLint bufLength = 0;
-            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &bufLength);
+            gGl.GetProgramiv(program, GL_INFO_LOG_LENGTH, &bufLength);
             if (bufLength) {
                 char* buf = (char*) malloc(bufLength);
                 if (buf) {
-                    glGetProgramInfoLog(program, bufLength, NULL, buf);
+                    gGl.GetProgramInfoLog(program, bufLength, NULL, buf);
                     LOGE("Could not link program:\n%s\n", buf);
                     free(buf);
                 }
             }
-            glDeleteProgram(program);
+            gGl.DeleteProgram(program);
             program = 0;
+        } else {
+            gProgramCache.store(cacheLabel, pVertexSource, pFragmentSource, program);
         }
     }
+    gGl.DeleteShader(vertexShader);
+    gGl.DeleteShader(fragmentShader);
+    reflection.reflect(program);
     return program;
 }
 
 /**
- * Configures and creates the OpenGL viewport based on the dimensions of the
- * window from the underlying platform's window system in which OpenGL content will render.
- * Also creates the shader program for use in renderFrame()
- * @param w the width of the display window
- * @param h the height of the display window
- * @return true if the shader program was created successfully and the viewport was set, false otherwise
+ * @return an identifier for the GL context current on this thread
+ */
+static void* currentGlContext() {
+#ifndef JNIDEMO_HEADLESS_GL
+    return (void*) eglGetCurrentContext();
+#else
+    // the headless backend has exactly one, everlasting context
+    static int headlessContext;
+    return &headlessContext;
+#endif
+}
+
+/**
+ * Drops our handles to GPU resources without deleting them.  Used when the
+ * EGL context that owned them has already been destroyed along with them.
+ */
+void forgetGraphics() {
+    gProgram.reset();
+    gInstancedProgram.reset();
+    gInstancedBatch.reset();
+    gUniformRing.reset();
+    gStreamingBuffer.reset();
+    gVboID = 0;
+    gVaoID = 0;
+    gResourceContext = nullptr;
+    gGraphicsReady = false;
+}
+
+/**
+ * Deletes all persistent resources once we're finished rendering, or whatever a
+ * failed initGraphics() managed to create.  Not needed when the EGL context is
+ * being destroyed anyway, since that takes our objects with it.
  */
-bool setupGraphics(int w, int h) {
+void teardownGraphics(){
+    gGl.DeleteProgram(gProgram.id());
+    gGl.DeleteBuffers(1, &gVboID);
+    gGl.DeleteVertexArrays(1, &gVaoID);
+    gGl.DeleteProgram(gInstancedProgram.id());
+    gInstancedBatch.destroy();
+    gUniformRing.destroy();
+    gStreamingBuffer.destroy();
+    forgetGraphics();
+}
+
+/**
+ * Creates every GPU resource the renderer needs -- vertex data, VAOs and shader
+ * programs.  This only has to happen once per EGL context: calling it again
+ * while the same context is current is a no-op, and a new context starts over
+ * from scratch since the previous context took its objects with it.
+ * @return true if the shader program was created successfully, false otherwise
+ */
+bool initGraphics() {
+    void* context = currentGlContext();
+    if (gGraphicsReady && context == gResourceContext) {
+        LOGI("initGraphics: resources already exist for this context");
+        return true;
+    }
+    forgetGraphics();
+
     printGLString("Version", GL_VERSION);
     printGLString("Vendor", GL_VENDOR);
     printGLString("Renderer", GL_RENDERER);
     printGLString("Extensions", GL_EXTENSIONS);
 
-    LOGI("setupGraphics(%d, %d)", w, h);
+    LOGI("initGraphics()");
+    gScene.clear();
+    int32_t sceneRoot = gScene.addNode(TransformHierarchy::kNoParent);
+    gTriangleNode = gScene.addNode(sceneRoot);
     // our triangle data, with vertices already in device coordinates between -1 and 1
     float vertices[] = {
             0.0f,  0.5f, // Vertex 1 (X, Y)
@@ -178,31 +343,38 @@ bool setupGraphics(int w, int h) {
             -0.5f, -0.5f  // Vertex 3 (X, Y)
     };
     // generate one vertex buffer object and store our handle to it
-    glGenBuffers(1,&gVboID);
+    gGl.GenBuffers(1,&gVboID);
     // make the VBO we just generated the active array
-    glBindBuffer(GL_ARRAY_BUFFER,gVboID);
+    gGl.BindBuffer(GL_ARRAY_BUFFER,gVboID);
     // upload our vertex data to the now-active VBO
     // GL_STATIC_DRAW mode is ideal for cases where we will be
     // rendering uploaded data more often than uploading new data
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    gGl.BufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     // generate and bind VAO so that our attibute -> VBO linkages below will
     // be tracked
-    glGenVertexArrays(1, &gVaoID);
-    glBindVertexArray(gVaoID);
+    gGl.GenVertexArrays(1, &gVaoID);
+    gGl.BindVertexArray(gVaoID);
 
     // now that data has been uploaded to the GPU, we need to tell the
     // GPU what to do with it -- that is where our shaders come in
-    gProgram = createProgram(gVertexShaderSource,gFragmentShaderSource);
-    if (!gProgram) {
+    if (!createProgram(gVertexShaderSource.c_str(),gFragmentShaderSource.c_str(),gProgram,"triangle")) {
         LOGE("Could not create program.");
+        // a retry in this context would forget, not delete, what was created so far
+        teardownGraphics();
         return false;
     }
     // activate our shader program
-    glUseProgram(gProgram);
-    // fetch the index of the named input, position
-    GLint posAttrib = glGetAttribLocation(gProgram, "position");
-    checkGlError("glGetAttribLocation");
-    LOGI("glGetAttribLocation(\"position\") = %d\n",
+    gProgram.use();
+    // per-frame constants come from a uniform buffer rather than glUniform* calls
+    gProgram.bindUniformBlock("FrameConstants", kFrameConstantsBinding);
+    if (!gUniformRing.init(sizeof(FrameConstants), 1)) {
+        LOGE("Could not create uniform buffer.");
+        teardownGraphics();
+        return false;
+    }
+    // fetch the index of the named input, position, as reflected at link time
+    GLint posAttrib = gProgram.attribLocation("position");
+    LOGI("attribLocation(\"position\") = %d\n",
          posAttrib);
     // instruct the vertex shader to consider our vertex data stored
     // in input position as having two components per attribute
@@ -211,57 +383,91 @@ bool setupGraphics(int w, int h) {
     // that stride (space between vertex attribute data) is 0, and that offset (space before
     // vertex attribute data starts) is 0.  This function will also bind
     // the attribute to the VBO currently bound to GL_ARRAY_BUFFER
-    glVertexAttribPointer(posAttrib, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    gGl.VertexAttribPointer(posAttrib, 2, GL_FLOAT, GL_FALSE, 0, 0);
     // enable the vertex attribute array
-    glEnableVertexAttribArray(posAttrib);
+    gGl.EnableVertexAttribArray(posAttrib);
 
-    // set up a viewport with the given width and height dimensions
-    glViewport(0, 0, w, h);
-    checkGlError("glViewport");
+    // the instanced path draws the same triangle through its own program and VAO
+    if (!gStreamingBuffer.init(kStreamingBufferBytes)) {
+        LOGE("Could not create streaming vertex buffer.");
+        teardownGraphics();
+        return false;
+    }
+    if (createProgram(gInstancedVertexShaderSource.c_str(), gInstancedFragmentShaderSource, gInstancedProgram,
+                      "instanced")
+        && gInstancedBatch.init(gInstancedProgram, gVboID, 3)) {
+        gInstancedProgram.bindUniformBlock("FrameConstants", kFrameConstantsBinding);
+    } else {
+        LOGE("Could not create instanced program; instancing disabled.");
+    }
+
+    checkGlError("initGraphics");
+    gResourceContext = context;
+    gGraphicsReady = true;
     t_start = std::chrono::high_resolution_clock::now();
     return true;
 }
 
 /**
- * Deletes all persistent resources once we're finished rendering
+ * Configures the OpenGL viewport based on the dimensions of the window from the
+ * underlying platform's window system in which OpenGL content will render, and
+ * rebuilds the projection that keeps our content's aspect ratio intact.  No GPU
+ * resources are created here, so a resize costs next to nothing.
+ * @param w the width of the display window
+ * @param h the height of the display window
  */
- /* EGL context destruction takes care of this
-void teardownGraphics(){
-    glDeleteProgram(gProgram);
-    glDeleteShader(gFragmentShaderID);
-    glDeleteShader(gVertexShaderID);
-    glDeleteBuffers(1, &gVboID);
-    glDeleteVertexArrays(1, &gVaoID);
+void resizeGraphics(int w, int h) {
+    LOGI("resizeGraphics(%d, %d)", w, h);
+    // set up a viewport with the given width and height dimensions
+    gGl.Viewport(0, 0, w, h);
+    checkGlError("glViewport");
+
+    // keep the unit square around the origin fully visible and undistorted,
+    // extending the visible area along the longer side of the surface
+    float aspect = (w > 0 && h > 0) ? (float) w / (float) h : 1.0f;
+    if (aspect >= 1.0f) {
+        gProjectionMat = glm::ortho(-aspect, aspect, -1.0f, 1.0f);
+    } else {
+        gProjectionMat = glm::ortho(-1.0f, 1.0f, -1.0f / aspect, 1.0f / aspect);
+    }
 }
-*/
 
 void renderFrame() {
+    if (!gGraphicsReady) {
+        return;
+    }
     // Clear the screen to black (bonus content: comment this to get a neat psychedlic
     // paint effect as the triangle rotates)
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT);
+    gGl.ClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    gGl.Clear(GL_COLOR_BUFFER_BIT);
 
-    // triangle rave hyyype!
-    GLint uniColor = glGetUniformLocation(gProgram, "u_triangleColor");
     auto t_now = std::chrono::high_resolution_clock::now();
     float elapsedTime = std::chrono::duration_cast<std::chrono::duration<float>>(t_now - t_start).count();
-    glUniform3f(uniColor, (sin(elapsedTime) + 1.0f) / 2.0f, 0.3f, (cos(elapsedTime) + 1.0f) / 2.0f);
+
+    // instanced mode: every triangle animated on the CPU, drawn with one call
+    size_t requestedInstances = (size_t) std::max(gRequestedInstanceCount.load(), 0);
+    if (requestedInstances != gInstancedBatch.instanceCount()) {
+        gInstancedBatch.setInstanceCount(requestedInstances, 0x5eedu);
+    }
+    // a failed batch init disables instancing, so the classic triangle is drawn instead
+    const bool instanced = gInstancedBatch.instanceCount() > 0 && gInstancedBatch.ready();
+
+    // triangle rave hyyype!
+    gFrameConstants.u_color = glm::vec3((sin(elapsedTime) + 1.0f) / 2.0f, 0.3f, (cos(elapsedTime) + 1.0f) / 2.0f);
+    gFrameConstants.u_projection = gProjectionMat;
+    gFrameConstants.u_time = elapsedTime;
 
     // rotation!
-    // init to identity matrix
-    glm::mat4 rotationMat = glm::mat4(1.0f);
-    // convert to rotation matrix with theta of 180 degrees
-    // counterclockwise (positive 1 in Z) over the Z axis
-    // todo: for some reason the result is not exactly what I expected --
-    // it looks like the axis of rotation is translating over time,
-    // and the vertices deform slightly over the course of rotation.
-    // A single rotation by 90 degrees shows correct rotation, but
-    // the triangle is no longer equilateral.
-    rotationMat = glm::rotate(
-            rotationMat,
-            elapsedTime * glm::radians(180.0f),
-            glm::vec3(0.0f, 0.0f, 1.0f)
-            );
+    // spin the triangle's scene node with theta of 180 degrees per second
+    // counterclockwise (positive 1 in Z) over the Z axis; only that node's
+    // world matrix is recomputed
+    // note: device coordinates stretch with the surface's aspect ratio, which
+    // used to make the triangle deform as it rotated.  gProjectionMat, applied
+    // below, undoes that stretch.
+    gScene.setRotation(gTriangleNode, glm::angleAxis(elapsedTime * glm::radians(180.0f),
+                                                     glm::vec3(0.0f, 0.0f, 1.0f)));
+    gScene.update();
+    const glm::mat4& rotationMat = gScene.world(gTriangleNode);
     /* test vector works as expected, so the rotation math is working as expected
     glm::vec4 simpleRotatedVector = rotationMat * glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
     LOGI("simple rotated vector was 1.0,0.0,0.0,1.0 before rotation and after is: %f, %f, %f\n", simpleRotatedVector.x, simpleRotatedVector.y, simpleRotatedVector.z);
@@ -280,26 +486,67 @@ void renderFrame() {
      translationToModelOriginMat = glm::translate(translationToModelOriginMat,glm::vec3(1.0f,1.0f,0.0f));
      completeTransformationMat = translationToGlOriginMat * rotationMat * translationToModelOriginMat;
     */
-    // grab a handle to our transformation matrix uniform in the vertex shader
-    GLint u_transformationMat = glGetUniformLocation(gProgram, "u_transformationMat");
+    // apply rotationMat to our vertex vector via u_transform, with the projection
+    // for the current surface shape applied last
+    gFrameConstants.u_transform = gProjectionMat * rotationMat;
 
-    // apply rotationMat to our vertex vector by uploading it to GPU in u_transformationMat
-    // GLM's value_ptr function will convert out mat4 client side into raw float array
-    // of length 16 to accommodate the 4x4 elements.
-    glUniformMatrix4fv(u_transformationMat, 1, GL_FALSE, glm::value_ptr(rotationMat));
+    // one contiguous upload covers every uniform either program reads this frame
+    gUniformRing.upload(gFrameConstants, kFrameConstantsBinding);
 
-    // tell the GPU to render our first (and only) 3 vertices
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    if (instanced) {
+        gInstancedProgram.use();
+        gInstancedBatch.update(elapsedTime);
+        gInstancedBatch.draw(gStreamingBuffer);
+    } else {
+        gProgram.use();
+        gGl.BindVertexArray(gVaoID);
+        // tell the GPU to render our first (and only) 3 vertices
+        gGl.DrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    gUniformRing.endFrame();
+    gStreamingBuffer.endFrame();
 }
 
 extern "C" JNIEXPORT jboolean JNICALL
 Java_com_jeffcreswell_jniopengl_jni_JniHooks_glInit(
+        JNIEnv *env,
+        jobject thiz) {
+
+    return initGraphics();
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glResize(
         JNIEnv *env,
         jobject thiz,
         jint width,
         jint height) {
 
-    return setupGraphics(width, height);
+    resizeGraphics(width, height);
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glSetProgramCacheDir(
+        JNIEnv *env,
+        jobject thiz,
+        jstring directory) {
+    if (!directory) {
+        gProgramCache.setDirectory(std::string());
+        return;
+    }
+    const char* path = env->GetStringUTFChars(directory, nullptr);
+    gProgramCache.setDirectory(path ? std::string(path) : std::string());
+    if (path) {
+        env->ReleaseStringUTFChars(directory, path);
+    }
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glSetInstanceCount(
+        JNIEnv *env,
+        jobject thiz,
+        jint count) {
+    gRequestedInstanceCount.store(count);
 }
 
 /* EGL takes care of this
@@ -315,7 +562,129 @@ extern "C" JNIEXPORT void JNICALL
 Java_com_jeffcreswell_jniopengl_jni_JniHooks_glStepFrame(
         JNIEnv *env,
         jobject thiz) {
+    auto frameStart = std::chrono::steady_clock::now();
     renderFrame();
+    auto frameEnd = std::chrono::steady_clock::now();
+    gFrameStats.record((uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(frameEnd - frameStart).count());
 }
 
+/**
+ * Indices into the summary array filled by glFrameStats; must match JniHooks.FRAME_STATS_*
+ */
+enum FrameStatsSummaryIndex {
+    kSummaryMeanMs,
+    kSummaryP50Ms,
+    kSummaryP95Ms,
+    kSummaryP99Ms,
+    kSummaryMaxMs,
+    kSummaryLength
+};
 
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glFrameStats(
+        JNIEnv *env,
+        jobject thiz,
+        jlongArray histogram,
+        jfloatArray summary) {
+    FrameStatsSummary stats = gFrameStats.summary();
+    if (summary) {
+        jfloat values[kSummaryLength];
+        values[kSummaryMeanMs] = stats.meanMs;
+        values[kSummaryP50Ms] = stats.p50Ms;
+        values[kSummaryP95Ms] = stats.p95Ms;
+        values[kSummaryP99Ms] = stats.p99Ms;
+        values[kSummaryMaxMs] = stats.maxMs;
+        jsize length = std::min<jsize>(env->GetArrayLength(summary), kSummaryLength);
+        env->SetFloatArrayRegion(summary, 0, length, values);
+    }
+    if (histogram) {
+        uint64_t counts[FrameStats::kHistogramBuckets];
+        jlong values[FrameStats::kHistogramBuckets];
+        size_t buckets = gFrameStats.histogram(counts, (size_t) env->GetArrayLength(histogram));
+        for (size_t i = 0; i < buckets; i++) {
+            values[i] = (jlong) counts[i];
+        }
+        env->SetLongArrayRegion(histogram, 0, (jsize) buckets, values);
+    }
+    return (jlong) stats.frameCount;
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glFrameHistogramBounds(
+        JNIEnv *env,
+        jobject thiz,
+        jfloatArray upperBoundsMs) {
+    if (!upperBoundsMs) {
+        return 0;
+    }
+    jfloat bounds[FrameStats::kHistogramBuckets];
+    jsize length = std::min<jsize>(env->GetArrayLength(upperBoundsMs), (jsize) FrameStats::kHistogramBuckets);
+    for (jsize i = 0; i < length; i++) {
+        bounds[i] = FrameStats::bucketUpperMs((size_t) i);
+    }
+    env->SetFloatArrayRegion(upperBoundsMs, 0, length, bounds);
+    return length;
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glRecentFrameTimes(
+        JNIEnv *env,
+        jobject thiz,
+        jintArray frameMicros) {
+    if (!frameMicros) {
+        return 0;
+    }
+    uint32_t recent[FrameStats::kWindow];
+    size_t count = gFrameStats.recentFrames(recent, std::min<size_t>((size_t) env->GetArrayLength(frameMicros),
+                                                                     FrameStats::kWindow));
+    env->SetIntArrayRegion(frameMicros, 0, (jsize) count, (const jint*) recent);
+    return (jint) count;
+}
+
+/**
+ * Indices into the array filled by glStreamingStats; must match JniHooks.STREAMING_STATS_*
+ */
+enum StreamingStatsIndex {
+    kStreamingFrameBytes,
+    kStreamingFrameWaitNanos,
+    kStreamingTotalBytes,
+    kStreamingTotalWaitNanos,
+    kStreamingStatsLength
+};
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_glStreamingStats(
+        JNIEnv *env,
+        jobject thiz,
+        jlongArray stats) {
+    jlong values[kStreamingStatsLength];
+    values[kStreamingFrameBytes] = (jlong) gStreamingBuffer.lastFrameBytes();
+    values[kStreamingFrameWaitNanos] = (jlong) gStreamingBuffer.lastFrameWaitNanos();
+    values[kStreamingTotalBytes] = (jlong) gStreamingBuffer.totalBytes();
+    values[kStreamingTotalWaitNanos] = (jlong) gStreamingBuffer.totalWaitNanos();
+    jsize length = std::min<jsize>(env->GetArrayLength(stats), kStreamingStatsLength);
+    env->SetLongArrayRegion(stats, 0, length, values);
+}
+
+/**
+ * Every native of this file, for JNI_OnLoad to register.  glDeinit has no
+ * native side (EGL tears the context down, see above), so it is left out.
+ */
+static const JNINativeMethod kGraphicsNatives[] = {
+        {"glInit", "()Z", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glInit},
+        {"glResize", "(II)V", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glResize},
+        {"glSetProgramCacheDir", "(Ljava/lang/String;)V",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glSetProgramCacheDir},
+        {"glSetInstanceCount", "(I)V", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glSetInstanceCount},
+        {"glStepFrame", "()V", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glStepFrame},
+        {"glFrameStats", "([J[F)J", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glFrameStats},
+        {"glFrameHistogramBounds", "([F)I",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glFrameHistogramBounds},
+        {"glRecentFrameTimes", "([I)I", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glRecentFrameTimes},
+        {"glStreamingStats", "([J)V", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_glStreamingStats},
+};
+
+bool registerGraphicsNatives(JNIEnv* env, jclass hooks) {
+    return env->RegisterNatives(hooks, kGraphicsNatives,
+                                sizeof(kGraphicsNatives) / sizeof(kGraphicsNatives[0])) == JNI_OK;
+}
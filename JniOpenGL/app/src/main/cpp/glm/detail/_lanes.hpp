@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref core
+/// @file glm/detail/_lanes.hpp
+/// @date 2026-10-17 / 2026-10-17
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "setup.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace glm{
+namespace detail
+{
+	// Lane traits for the batch extensions. A kernel is written once against
+	// L::type, L::add and friends and instantiated with lanes_sse (four
+	// floats), lanes_avx (eight floats) or lanes_scalar (one value, for array
+	// tails and builds without SIMD). Comparisons return an L::mask that
+	// select consumes. ramp(s) holds s, s + 1, s + 2... across the lanes.
+	// store4 interleaves four registers: lane j of a, b, c
+	// and d becomes the four floats at p + j * stride.
+
+	template <typename T>
+	struct lanes_scalar
+	{
+		typedef T type;
+		typedef bool mask;
+		enum { size = 1 };
+
+		GLM_FUNC_QUALIFIER static type set1(T s) { return s; }
+		GLM_FUNC_QUALIFIER static type ramp(T s) { return s; }
+		GLM_FUNC_QUALIFIER static type load(T const * p) { return *p; }
+		GLM_FUNC_QUALIFIER static void store(T * p, type v) { *p = v; }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return a + b; }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return a - b; }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return a * b; }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return a / b; }
+		GLM_FUNC_QUALIFIER static type neg(type a) { return -a; }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return std::sqrt(a); }
+		GLM_FUNC_QUALIFIER static type round(type a) { return std::nearbyint(a); }
+		GLM_FUNC_QUALIFIER static type floor(type a) { return std::floor(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return a >= static_cast<T>(0) ? a : -a; }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return b < a ? b : a; }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return a < b ? b : a; }
+		GLM_FUNC_QUALIFIER static mask less(type a, type b) { return a < b; }
+		GLM_FUNC_QUALIFIER static mask greater(type a, type b) { return a > b; }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b) { return m ? a : b; }
+
+		GLM_FUNC_QUALIFIER static void store4(T * p, std::size_t, type a, type b, type c, type d)
+		{
+			p[0] = a;
+			p[1] = b;
+			p[2] = c;
+			p[3] = d;
+		}
+	};
+
+#if GLM_ARCH & GLM_ARCH_SSE2
+	struct lanes_sse
+	{
+		typedef __m128 type;
+		typedef __m128 mask;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type ramp(float s) { return _mm_add_ps(_mm_set1_ps(s), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)); }
+		GLM_FUNC_QUALIFIER static type load(float const * p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float * p, type v) { _mm_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm_sqrt_ps(a); }
+
+		// Nearest, ties to even. Without SSE4 this goes through int32, which
+		// overflows past 2^31; from 2^23 up every float is already an integer,
+		// so those lanes (and NaNs) pass through untouched.
+		GLM_FUNC_QUALIFIER static type round(type a)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE4
+				return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#			else
+				mask const Integral = _mm_cmpnlt_ps(abs(a), _mm_set1_ps(8388608.0f));
+				return select(Integral, a, _mm_cvtepi32_ps(_mm_cvtps_epi32(a)));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type a)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE4
+				return _mm_floor_ps(a);
+#			else
+				type const r = round(a);
+				return _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, a), _mm_set1_ps(1.0f)));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask less(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask greater(type a, type b) { return _mm_cmpgt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE4
+				return _mm_blendv_ps(b, a, m);
+#			else
+				return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static void store4(float * p, std::size_t stride, type a, type b, type c, type d)
+		{
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			_mm_storeu_ps(p, a);
+			_mm_storeu_ps(p + stride, b);
+			_mm_storeu_ps(p + stride * 2, c);
+			_mm_storeu_ps(p + stride * 3, d);
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+#if GLM_ARCH & GLM_ARCH_AVX
+	struct lanes_avx
+	{
+		typedef __m256 type;
+		typedef __m256 mask;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static type set1(float s) { return _mm256_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type ramp(float s) { return _mm256_add_ps(_mm256_set1_ps(s), _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f)); }
+		GLM_FUNC_QUALIFIER static type load(float const * p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float * p, type v) { _mm256_storeu_ps(p, v); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type round(type a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm256_floor_ps(a); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask less(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static mask greater(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static type select(mask m, type a, type b) { return _mm256_or_ps(_mm256_and_ps(m, a), _mm256_andnot_ps(m, b)); }
+
+		// Transposes within each 128-bit half, then stores lanes 0-3 from the
+		// low halves and lanes 4-7 from the high halves
+		GLM_FUNC_QUALIFIER static void store4(float * p, std::size_t stride, type a, type b, type c, type d)
+		{
+			__m256 const ab01 = _mm256_unpacklo_ps(a, b);
+			__m256 const ab23 = _mm256_unpackhi_ps(a, b);
+			__m256 const cd01 = _mm256_unpacklo_ps(c, d);
+			__m256 const cd23 = _mm256_unpackhi_ps(c, d);
+			__m256 const v0 = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 const v1 = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(3, 2, 3, 2));
+			__m256 const v2 = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(1, 0, 1, 0));
+			__m256 const v3 = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(3, 2, 3, 2));
+			_mm_storeu_ps(p, _mm256_castps256_ps128(v0));
+			_mm_storeu_ps(p + stride, _mm256_castps256_ps128(v1));
+			_mm_storeu_ps(p + stride * 2, _mm256_castps256_ps128(v2));
+			_mm_storeu_ps(p + stride * 3, _mm256_castps256_ps128(v3));
+			_mm_storeu_ps(p + stride * 4, _mm256_extractf128_ps(v0, 1));
+			_mm_storeu_ps(p + stride * 5, _mm256_extractf128_ps(v1, 1));
+			_mm_storeu_ps(p + stride * 6, _mm256_extractf128_ps(v2, 1));
+			_mm_storeu_ps(p + stride * 7, _mm256_extractf128_ps(v3, 1));
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_AVX
+}//namespace detail
+}//namespace glm
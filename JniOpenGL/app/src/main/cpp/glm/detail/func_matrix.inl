@@ -215,6 +215,19 @@ namespace detail
 		}
 	};
 
+#if GLM_HAS_SIMD_CORE
+	template <precision P>
+	struct compute_transpose<tmat4x4, float, P>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m)
+		{
+			tmat4x4<float, P> result(uninitialize);
+			sse_transpose_ps(&m[0].data, &result[0].data);
+			return result;
+		}
+	};
+#endif//GLM_HAS_SIMD_CORE
+
 	template <template <class, precision> class matType, typename T, precision P>
 	struct compute_determinant{};
 
@@ -654,6 +654,23 @@
 #	endif
 #endif//GLM_ARCH
 
+///////////////////////////////////////////////////////////////////////////////////
+// SIMD core types
+
+// User defines: GLM_FORCE_SIMD_CORE
+
+// With GLM_FORCE_SIMD_CORE, tvec4<float> keeps its components in an __m128 and
+// the core tvec4<float> and tmat4x4<float> arithmetic, transpose and inverse
+// dispatch to the SSE kernels of intrinsic_matrix.inl, at every precision.
+// Both types are then 16 byte aligned: heap storage must honour that, which
+// 32 bit x86 allocators do not guarantee. Other vector types, integer tvec4
+// included, keep their size and alignment. Ignored without SSE2.
+#if defined(GLM_FORCE_SIMD_CORE) && (GLM_ARCH & GLM_ARCH_SSE2)
+#	define GLM_HAS_SIMD_CORE 1
+#else
+#	define GLM_HAS_SIMD_CORE 0
+#endif
+
 #if defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_ARCH_DISPLAYED)
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
@@ -667,6 +684,9 @@
 #	elif(GLM_ARCH & GLM_ARCH_SSE2)
 #		pragma message("GLM: SSE2 instruction set")
 #	endif//GLM_ARCH
+#	if GLM_HAS_SIMD_CORE
+#		pragma message("GLM: SIMD core types")
+#	endif
 #	pragma message("GLM: #define GLM_FORCE_PURE to avoid using platform specific instruction sets")
 #endif//GLM_MESSAGE
 
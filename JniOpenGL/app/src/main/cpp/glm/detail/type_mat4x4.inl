@@ -30,65 +30,207 @@
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
+#if GLM_HAS_SIMD_CORE
+#	include "intrinsic_matrix.hpp"
+#endif//GLM_HAS_SIMD_CORE
+
 namespace glm{
 namespace detail
 {
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER tmat4x4<T, P> compute_inverse(tmat4x4<T, P> const & m)
+	struct compute_mat4_inverse
 	{
-		T Coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-		T Coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-		T Coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m)
+		{
+			T Coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+			T Coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+			T Coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+
+			T Coef04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+			T Coef06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+			T Coef07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
 
-		T Coef04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-		T Coef06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-		T Coef07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+			T Coef08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+			T Coef10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+			T Coef11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
 
-		T Coef08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-		T Coef10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
-		T Coef11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+			T Coef12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+			T Coef14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+			T Coef15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
 
-		T Coef12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-		T Coef14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
-		T Coef15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+			T Coef16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+			T Coef18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+			T Coef19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
 
-		T Coef16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-		T Coef18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
-		T Coef19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+			T Coef20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+			T Coef22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+			T Coef23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
 
-		T Coef20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-		T Coef22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
-		T Coef23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+			tvec4<T, P> Fac0(Coef00, Coef00, Coef02, Coef03);
+			tvec4<T, P> Fac1(Coef04, Coef04, Coef06, Coef07);
+			tvec4<T, P> Fac2(Coef08, Coef08, Coef10, Coef11);
+			tvec4<T, P> Fac3(Coef12, Coef12, Coef14, Coef15);
+			tvec4<T, P> Fac4(Coef16, Coef16, Coef18, Coef19);
+			tvec4<T, P> Fac5(Coef20, Coef20, Coef22, Coef23);
 
-		tvec4<T, P> Fac0(Coef00, Coef00, Coef02, Coef03);
-		tvec4<T, P> Fac1(Coef04, Coef04, Coef06, Coef07);
-		tvec4<T, P> Fac2(Coef08, Coef08, Coef10, Coef11);
-		tvec4<T, P> Fac3(Coef12, Coef12, Coef14, Coef15);
-		tvec4<T, P> Fac4(Coef16, Coef16, Coef18, Coef19);
-		tvec4<T, P> Fac5(Coef20, Coef20, Coef22, Coef23);
+			tvec4<T, P> Vec0(m[1][0], m[0][0], m[0][0], m[0][0]);
+			tvec4<T, P> Vec1(m[1][1], m[0][1], m[0][1], m[0][1]);
+			tvec4<T, P> Vec2(m[1][2], m[0][2], m[0][2], m[0][2]);
+			tvec4<T, P> Vec3(m[1][3], m[0][3], m[0][3], m[0][3]);
 
-		tvec4<T, P> Vec0(m[1][0], m[0][0], m[0][0], m[0][0]);
-		tvec4<T, P> Vec1(m[1][1], m[0][1], m[0][1], m[0][1]);
-		tvec4<T, P> Vec2(m[1][2], m[0][2], m[0][2], m[0][2]);
-		tvec4<T, P> Vec3(m[1][3], m[0][3], m[0][3], m[0][3]);
+			tvec4<T, P> Inv0(Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2);
+			tvec4<T, P> Inv1(Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4);
+			tvec4<T, P> Inv2(Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5);
+			tvec4<T, P> Inv3(Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5);
 
-		tvec4<T, P> Inv0(Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2);
-		tvec4<T, P> Inv1(Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4);
-		tvec4<T, P> Inv2(Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5);
-		tvec4<T, P> Inv3(Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5);
+			tvec4<T, P> SignA(+1, -1, +1, -1);
+			tvec4<T, P> SignB(-1, +1, -1, +1);
+			tmat4x4<T, P> Inverse(Inv0 * SignA, Inv1 * SignB, Inv2 * SignA, Inv3 * SignB);
 
-		tvec4<T, P> SignA(+1, -1, +1, -1);
-		tvec4<T, P> SignB(-1, +1, -1, +1);
-		tmat4x4<T, P> Inverse(Inv0 * SignA, Inv1 * SignB, Inv2 * SignA, Inv3 * SignB);
+			tvec4<T, P> Row0(Inverse[0][0], Inverse[1][0], Inverse[2][0], Inverse[3][0]);
 
-		tvec4<T, P> Row0(Inverse[0][0], Inverse[1][0], Inverse[2][0], Inverse[3][0]);
+			tvec4<T, P> Dot0(m[0] * Row0);
+			T Dot1 = (Dot0.x + Dot0.y) + (Dot0.z + Dot0.w);
 
-		tvec4<T, P> Dot0(m[0] * Row0);
-		T Dot1 = (Dot0.x + Dot0.y) + (Dot0.z + Dot0.w);
+			T OneOverDeterminant = static_cast<T>(1) / Dot1;
 
-		T OneOverDeterminant = static_cast<T>(1) / Dot1;
+			return Inverse * OneOverDeterminant;
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_mat4_add
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			return tmat4x4<T, P>(
+				m1[0] + m2[0],
+				m1[1] + m2[1],
+				m1[2] + m2[2],
+				m1[3] + m2[3]);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_mat4_mul_vec4
+	{
+		GLM_FUNC_QUALIFIER static typename tmat4x4<T, P>::col_type call(tmat4x4<T, P> const & m, typename tmat4x4<T, P>::row_type const & v)
+		{
+			typename tmat4x4<T, P>::col_type const Mov0(v[0]);
+			typename tmat4x4<T, P>::col_type const Mov1(v[1]);
+			typename tmat4x4<T, P>::col_type const Mul0 = m[0] * Mov0;
+			typename tmat4x4<T, P>::col_type const Mul1 = m[1] * Mov1;
+			typename tmat4x4<T, P>::col_type const Add0 = Mul0 + Mul1;
+			typename tmat4x4<T, P>::col_type const Mov2(v[2]);
+			typename tmat4x4<T, P>::col_type const Mov3(v[3]);
+			typename tmat4x4<T, P>::col_type const Mul2 = m[2] * Mov2;
+			typename tmat4x4<T, P>::col_type const Mul3 = m[3] * Mov3;
+			typename tmat4x4<T, P>::col_type const Add1 = Mul2 + Mul3;
+			typename tmat4x4<T, P>::col_type const Add2 = Add0 + Add1;
+			return Add2;
+		}
+	};
 
-		return Inverse * OneOverDeterminant;
+	template <typename T, precision P>
+	struct compute_vec4_mul_mat4
+	{
+		GLM_FUNC_QUALIFIER static typename tmat4x4<T, P>::row_type call(typename tmat4x4<T, P>::col_type const & v, tmat4x4<T, P> const & m)
+		{
+			return typename tmat4x4<T, P>::row_type(
+				m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
+				m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
+				m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
+				m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_mat4_mul
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
+			typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
+			typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
+			typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
+
+			typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
+			typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
+			typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
+			typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
+
+			tmat4x4<T, P> Result(uninitialize);
+			Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
+			Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
+			Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
+			Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
+			return Result;
+		}
+	};
+
+#if GLM_HAS_SIMD_CORE
+	// The columns of a tmat4x4<float> are consecutive __m128, as the kernels expect
+
+	template <precision P>
+	struct compute_mat4_inverse<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			sse_inverse_ps(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_add<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			sse_add_ps(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul_vec4<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = sse_mul_ps(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul_mat4<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v, tmat4x4<float, P> const & m)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = sse_mul_ps(v.data, &m[0].data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			sse_mul_ps(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#endif//GLM_HAS_SIMD_CORE
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tmat4x4<T, P> compute_inverse(tmat4x4<T, P> const & m)
+	{
+		return compute_mat4_inverse<T, P>::call(m);
 	}
 }//namespace detail
 
@@ -510,11 +652,7 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator+(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
 	{
-		return tmat4x4<T, P>(
-			m1[0] + m2[0],
-			m1[1] + m2[1],
-			m1[2] + m2[2],
-			m1[3] + m2[3]);
+		return detail::compute_mat4_add<T, P>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -574,45 +712,7 @@ namespace detail
 		typename tmat4x4<T, P>::row_type const & v
 	)
 	{
-/*
-		__m128 v0 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 v1 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 v2 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 v3 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(m[0].data, v0);
-		__m128 m1 = _mm_mul_ps(m[1].data, v1);
-		__m128 a0 = _mm_add_ps(m0, m1);
-
-		__m128 m2 = _mm_mul_ps(m[2].data, v2);
-		__m128 m3 = _mm_mul_ps(m[3].data, v3);
-		__m128 a1 = _mm_add_ps(m2, m3);
-
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		return typename tmat4x4<T, P>::col_type(a2);
-*/
-
-		typename tmat4x4<T, P>::col_type const Mov0(v[0]);
-		typename tmat4x4<T, P>::col_type const Mov1(v[1]);
-		typename tmat4x4<T, P>::col_type const Mul0 = m[0] * Mov0;
-		typename tmat4x4<T, P>::col_type const Mul1 = m[1] * Mov1;
-		typename tmat4x4<T, P>::col_type const Add0 = Mul0 + Mul1;
-		typename tmat4x4<T, P>::col_type const Mov2(v[2]);
-		typename tmat4x4<T, P>::col_type const Mov3(v[3]);
-		typename tmat4x4<T, P>::col_type const Mul2 = m[2] * Mov2;
-		typename tmat4x4<T, P>::col_type const Mul3 = m[3] * Mov3;
-		typename tmat4x4<T, P>::col_type const Add1 = Mul2 + Mul3;
-		typename tmat4x4<T, P>::col_type const Add2 = Add0 + Add1;
-		return Add2;
-
-/*
-		return typename tmat4x4<T, P>::col_type(
-			m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3],
-			m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3],
-			m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3],
-			m[0][3] * v[0] + m[1][3] * v[1] + m[2][3] * v[2] + m[3][3] * v[3]);
-*/
+		return detail::compute_mat4_mul_vec4<T, P>::call(m, v);
 	}
 
 	template <typename T, precision P>
@@ -622,11 +722,7 @@ namespace detail
 		tmat4x4<T, P> const & m
 	)
 	{
-		return typename tmat4x4<T, P>::row_type(
-			m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
-			m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
-			m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
-			m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		return detail::compute_vec4_mul_mat4<T, P>::call(v, m);
 	}
 
 	template <typename T, precision P>
@@ -664,22 +760,7 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator*(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
 	{
-		typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
-		typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
-		typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
-		typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
-
-		typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
-		typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
-		typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
-		typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
-
-		tmat4x4<T, P> Result(uninitialize);
-		Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
-		Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
-		Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
-		Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
-		return Result;
+		return detail::compute_mat4_mul<T, P>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -73,6 +73,22 @@ namespace detail
 		};
 #	endif
 
+#	if GLM_HAS_SIMD_CORE
+		// tvec4 storage under GLM_FORCE_SIMD_CORE: only float gets a register,
+		// so every other tvec4 keeps its size and alignment
+		template <typename T>
+		struct simd_core
+		{
+			typedef T type[4];
+		};
+
+		template <>
+		struct simd_core<float>
+		{
+			typedef __m128 type;
+		};
+#	endif
+
 #	if GLM_ARCH & GLM_ARCH_AVX
 		template <>
 		struct simd<double>
@@ -130,6 +146,18 @@ namespace detail
 					_GLM_SWIZZLE4_4_MEMBERS(T, P, tvec4, s, t, p, q)
 #				endif//GLM_SWIZZLE
 			};
+#		elif GLM_HAS_SIMD_CORE
+			union
+			{
+				typename detail::simd_core<T>::type data;
+				struct { T r, g, b, a; };
+				struct { T s, t, p, q; };
+				struct { T x, y, z, w;};
+			};
+
+#			ifdef GLM_SWIZZLE
+				GLM_SWIZZLE_GEN_VEC_FROM_VEC4(T, P, tvec4, tvec2, tvec3, tvec4)
+#			endif//GLM_SWIZZLE
 #		else
 			union { T x, r, s; };
 			union { T y, g, t; };
@@ -36,6 +36,7 @@
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
 #include <cstring>
+#include <limits>
 
 namespace glm{
 namespace detail
@@ -165,9 +166,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 6))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed11ToFloat(x);
 
@@ -204,9 +205,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 5))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed10ToFloat(x);
 
@@ -337,7 +338,7 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER float unpackSnorm1x16(uint16 p)
 	{
-		float Unpack = static_cast<float>(*const_cast<uint16*>(&p));
+		float Unpack = static_cast<float>(*reinterpret_cast<int16*>(&p));
 		return clamp(
 			Unpack * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f, 
 			-1.0f, 1.0f);
@@ -461,17 +462,17 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 packUnorm3x10_1x2(vec4 const & v)
 	{
-		detail::i10i10i10i2 Result;
-		Result.data.x = int(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
-		Result.data.y = int(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
-		Result.data.z = int(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
-		Result.data.w = int(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
+		detail::u10u10u10u2 Result;
+		Result.data.x = uint(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
+		Result.data.y = uint(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
+		Result.data.z = uint(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
+		Result.data.w = uint(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
 		return Result.pack;
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm3x10_1x2(uint32 v)
 	{
-		detail::i10i10i10i2 Unpack;
+		detail::u10u10u10u2 Unpack;
 		Unpack.pack = v;
 		vec4 Result;
 		Result.x = float(Unpack.data.x) / 1023.f;
@@ -492,9 +493,9 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec3 unpackF2x11_1x10(uint32 v)
 	{
 		return vec3(
-			detail::packed11bitToFloat(v >> 0), 
-			detail::packed11bitToFloat(v >> 11), 
-			detail::packed10bitToFloat(v >> 22));
+			detail::packed11bitToFloat((v >> 0) & ((1 << 11) - 1)),
+			detail::packed11bitToFloat((v >> 11) & ((1 << 11) - 1)),
+			detail::packed10bitToFloat((v >> 22) & ((1 << 10) - 1)));
 	}
 
 }//namespace glm
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.hpp
+/// @date 2026-10-17 / 2026-10-17
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_batch GLM_GTX_noise_batch
+/// @ingroup gtx
+///
+/// @brief Evaluate perlin and simplex noise over arrays of points and fill
+/// grids with fractal noise.
+///
+/// Points are passed as one array per coordinate. For float, each lane of an
+/// SSE2 register (four points) or an AVX register (eight points) follows
+/// the gtc_noise code for one point, operation for operation, when GLM_ARCH
+/// enables them; the points left over go through the same code one at a
+/// time. Results therefore equal perlin and simplex bit for bit unless the
+/// compiler fuses multiply-adds (-ffp-contract=fast on an FMA target).
+/// Fused builds usually stay within 1e-5, but 3D perlin picks its gradients
+/// by comparing rounded values against zero, so a fused perlin(vec3) can
+/// itself move by up to 0.75 from an unfused one near such ties, and the
+/// two paths may then disagree by as much. Build with -ffp-contract=off
+/// where exact agreement matters. Other value types call the gtc_noise
+/// functions point by point.
+///
+/// <glm/gtx/noise_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_noise_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_batch
+	/// @{
+
+	/// Classic perlin noise of count 2D points: out[i] = perlin(tvec2(x[i], y[i])).
+	///
+	/// @see gtx_noise_batch
+	template <typename T>
+	GLM_FUNC_DECL void perlin(
+		T const * x, T const * y,
+		T * out,
+		std::size_t count);
+
+	/// Classic perlin noise of count 3D points: out[i] = perlin(tvec3(x[i], y[i], z[i])).
+	///
+	/// @see gtx_noise_batch
+	template <typename T>
+	GLM_FUNC_DECL void perlin(
+		T const * x, T const * y, T const * z,
+		T * out,
+		std::size_t count);
+
+	/// Simplex noise of count 2D points: out[i] = simplex(tvec2(x[i], y[i])).
+	///
+	/// @see gtx_noise_batch
+	template <typename T>
+	GLM_FUNC_DECL void simplex(
+		T const * x, T const * y,
+		T * out,
+		std::size_t count);
+
+	/// Simplex noise of count 3D points: out[i] = simplex(tvec3(x[i], y[i], z[i])).
+	///
+	/// @see gtx_noise_batch
+	template <typename T>
+	GLM_FUNC_DECL void simplex(
+		T const * x, T const * y, T const * z,
+		T * out,
+		std::size_t count);
+
+	/// Fills a width by height grid, row by row, with fractal perlin noise.
+	/// Sample (i, j) lies at p = origin + step * tvec2(i, j) and is the sum,
+	/// over octaves, of amplitude * perlin(p * frequency), where frequency
+	/// starts at 1 and is multiplied by lacunarity after each octave, and
+	/// amplitude starts at 1 and is multiplied by gain.
+	///
+	/// @see gtx_noise_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void perlinFractal(
+		tvec2<T, P> const & origin,
+		tvec2<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height);
+
+	/// Fills a width by height by depth grid with fractal perlin noise:
+	/// out[(k * height + j) * width + i] samples origin + step * tvec3(i, j, k).
+	///
+	/// @see gtx_noise_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void perlinFractal(
+		tvec3<T, P> const & origin,
+		tvec3<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height, std::size_t depth);
+
+	/// perlinFractal with simplex noise.
+	///
+	/// @see gtx_noise_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void simplexFractal(
+		tvec2<T, P> const & origin,
+		tvec2<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height);
+
+	/// perlinFractal with simplex noise.
+	///
+	/// @see gtx_noise_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void simplexFractal(
+		tvec3<T, P> const & origin,
+		tvec3<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height, std::size_t depth);
+
+	/// @}
+}// namespace glm
+
+#include "noise_batch.inl"
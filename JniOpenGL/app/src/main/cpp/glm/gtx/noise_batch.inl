@@ -0,0 +1,687 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_noise_batch
+/// @file glm/gtx/noise_batch.inl
+/// @date 2026-10-17 / 2026-10-17
+///////////////////////////////////////////////////////////////////////////////////
+// The lane kernels below transcribe gtc/noise.inl: every operation of the
+// scalar code appears here on registers, in the same order, so that each lane
+// rounds exactly like one call of perlin or simplex.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "../detail/_lanes.hpp"
+
+namespace glm{
+namespace detail
+{
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_fract(typename L::type x)
+	{
+		return L::sub(x, L::floor(x));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_mod289(typename L::type x)
+	{
+		typename L::type const Ring = L::set1(289.0f);
+		return L::sub(x, L::mul(L::floor(L::div(x, Ring)), Ring));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_permute(typename L::type x)
+	{
+		return noise_batch_mod289<L>(L::mul(L::add(L::mul(x, L::set1(34.0f)), L::set1(1.0f)), x));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_taylorInvSqrt(typename L::type r)
+	{
+		return L::sub(L::set1(static_cast<float>(1.79284291400159)), L::mul(L::set1(static_cast<float>(0.85373472095314)), r));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_fade(typename L::type t)
+	{
+		return L::mul(L::mul(L::mul(t, t), t), L::add(L::mul(t, L::sub(L::mul(t, L::set1(6.0f)), L::set1(15.0f))), L::set1(10.0f)));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_mix(typename L::type x, typename L::type y, typename L::type a)
+	{
+		return L::add(x, L::mul(a, L::sub(y, x)));
+	}
+
+	// step(edge, x)
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_step(typename L::type edge, typename L::type x)
+	{
+		return L::select(L::less(x, edge), L::set1(0.0f), L::set1(1.0f));
+	}
+
+	// One corner of 2D perlin: the gradient picked by hash i, normalised and
+	// dotted with the offset (fx, fy) from that corner
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_perlin2_corner(typename L::type i, typename L::type fx, typename L::type fy)
+	{
+		typedef typename L::type type;
+		type gx = L::sub(L::mul(L::set1(2.0f), noise_batch_fract<L>(L::div(i, L::set1(41.0f)))), L::set1(1.0f));
+		type gy = L::sub(L::abs(gx), L::set1(0.5f));
+		type const tx = L::floor(L::add(gx, L::set1(0.5f)));
+		gx = L::sub(gx, tx);
+
+		type const norm = noise_batch_taylorInvSqrt<L>(L::add(L::mul(gx, gx), L::mul(gy, gy)));
+		gx = L::mul(gx, norm);
+		gy = L::mul(gy, norm);
+		return L::add(L::mul(gx, fx), L::mul(gy, fy));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_perlin2(typename L::type x, typename L::type y)
+	{
+		typedef typename L::type type;
+		type const One = L::set1(1.0f);
+
+		type const Fx = L::floor(x);
+		type const Fy = L::floor(y);
+		type const ix0 = noise_batch_mod289<L>(Fx);
+		type const iy0 = noise_batch_mod289<L>(Fy);
+		type const ix1 = noise_batch_mod289<L>(L::add(Fx, One));
+		type const iy1 = noise_batch_mod289<L>(L::add(Fy, One));
+		type const fx0 = noise_batch_fract<L>(x);
+		type const fy0 = noise_batch_fract<L>(y);
+		type const fx1 = L::sub(fx0, One);
+		type const fy1 = L::sub(fy0, One);
+
+		type const px0 = noise_batch_permute<L>(ix0);
+		type const px1 = noise_batch_permute<L>(ix1);
+		type const n00 = noise_batch_perlin2_corner<L>(noise_batch_permute<L>(L::add(px0, iy0)), fx0, fy0);
+		type const n10 = noise_batch_perlin2_corner<L>(noise_batch_permute<L>(L::add(px1, iy0)), fx1, fy0);
+		type const n01 = noise_batch_perlin2_corner<L>(noise_batch_permute<L>(L::add(px0, iy1)), fx0, fy1);
+		type const n11 = noise_batch_perlin2_corner<L>(noise_batch_permute<L>(L::add(px1, iy1)), fx1, fy1);
+
+		type const FadeX = noise_batch_fade<L>(fx0);
+		type const FadeY = noise_batch_fade<L>(fy0);
+		type const n_x0 = noise_batch_mix<L>(n00, n10, FadeX);
+		type const n_x1 = noise_batch_mix<L>(n01, n11, FadeX);
+		return L::mul(L::set1(static_cast<float>(2.3)), noise_batch_mix<L>(n_x0, n_x1, FadeY));
+	}
+
+	// One corner of 3D perlin, from the hash of the corner's column and layer
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_perlin3_corner(typename L::type ixyz, typename L::type fx, typename L::type fy, typename L::type fz)
+	{
+		typedef typename L::type type;
+		type const Zero = L::set1(0.0f);
+		type const Half = L::set1(0.5f);
+		type const Seventh = L::set1(static_cast<float>(1.0 / 7.0));
+
+		type gx = L::mul(ixyz, Seventh);
+		type gy = L::sub(noise_batch_fract<L>(L::mul(L::floor(gx), Seventh)), Half);
+		gx = noise_batch_fract<L>(gx);
+		type const gz = L::sub(L::sub(Half, L::abs(gx)), L::abs(gy));
+		type const sz = noise_batch_step<L>(gz, Zero);
+		gx = L::sub(gx, L::mul(sz, L::sub(noise_batch_step<L>(Zero, gx), Half)));
+		gy = L::sub(gy, L::mul(sz, L::sub(noise_batch_step<L>(Zero, gy), Half)));
+
+		type const norm = noise_batch_taylorInvSqrt<L>(L::add(L::add(L::mul(gx, gx), L::mul(gy, gy)), L::mul(gz, gz)));
+		return L::add(L::add(L::mul(L::mul(gx, norm), fx), L::mul(L::mul(gy, norm), fy)), L::mul(L::mul(gz, norm), fz));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_perlin3(typename L::type x, typename L::type y, typename L::type z)
+	{
+		typedef typename L::type type;
+		type const One = L::set1(1.0f);
+
+		type const Fx = L::floor(x);
+		type const Fy = L::floor(y);
+		type const Fz = L::floor(z);
+		type const ix0 = noise_batch_mod289<L>(Fx);
+		type const iy0 = noise_batch_mod289<L>(Fy);
+		type const iz0 = noise_batch_mod289<L>(Fz);
+		type const ix1 = noise_batch_mod289<L>(L::add(Fx, One));
+		type const iy1 = noise_batch_mod289<L>(L::add(Fy, One));
+		type const iz1 = noise_batch_mod289<L>(L::add(Fz, One));
+		type const fx0 = noise_batch_fract<L>(x);
+		type const fy0 = noise_batch_fract<L>(y);
+		type const fz0 = noise_batch_fract<L>(z);
+		type const fx1 = L::sub(fx0, One);
+		type const fy1 = L::sub(fy0, One);
+		type const fz1 = L::sub(fz0, One);
+
+		type const px0 = noise_batch_permute<L>(ix0);
+		type const px1 = noise_batch_permute<L>(ix1);
+		type const ixy00 = noise_batch_permute<L>(L::add(px0, iy0));
+		type const ixy10 = noise_batch_permute<L>(L::add(px1, iy0));
+		type const ixy01 = noise_batch_permute<L>(L::add(px0, iy1));
+		type const ixy11 = noise_batch_permute<L>(L::add(px1, iy1));
+
+		type const n000 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy00, iz0)), fx0, fy0, fz0);
+		type const n100 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy10, iz0)), fx1, fy0, fz0);
+		type const n010 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy01, iz0)), fx0, fy1, fz0);
+		type const n110 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy11, iz0)), fx1, fy1, fz0);
+		type const n001 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy00, iz1)), fx0, fy0, fz1);
+		type const n101 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy10, iz1)), fx1, fy0, fz1);
+		type const n011 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy01, iz1)), fx0, fy1, fz1);
+		type const n111 = noise_batch_perlin3_corner<L>(noise_batch_permute<L>(L::add(ixy11, iz1)), fx1, fy1, fz1);
+
+		type const FadeX = noise_batch_fade<L>(fx0);
+		type const FadeY = noise_batch_fade<L>(fy0);
+		type const FadeZ = noise_batch_fade<L>(fz0);
+		type const n_z00 = noise_batch_mix<L>(n000, n001, FadeZ);
+		type const n_z10 = noise_batch_mix<L>(n100, n101, FadeZ);
+		type const n_z01 = noise_batch_mix<L>(n010, n011, FadeZ);
+		type const n_z11 = noise_batch_mix<L>(n110, n111, FadeZ);
+		type const n_yz0 = noise_batch_mix<L>(n_z00, n_z01, FadeY);
+		type const n_yz1 = noise_batch_mix<L>(n_z10, n_z11, FadeY);
+		return L::mul(L::set1(static_cast<float>(2.2)), noise_batch_mix<L>(n_yz0, n_yz1, FadeX));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_simplex2(typename L::type vx, typename L::type vy)
+	{
+		typedef typename L::type type;
+		type const Zero = L::set1(0.0f);
+		type const One = L::set1(1.0f);
+		type const Half = L::set1(0.5f);
+		type const C0 = L::set1(static_cast<float>(0.211324865405187));
+		type const C1 = L::set1(static_cast<float>(0.366025403784439));
+		type const C2 = L::set1(static_cast<float>(-0.577350269189626));
+		type const C3 = L::set1(static_cast<float>(0.024390243902439));
+
+		// First corner
+		type const s = L::add(L::mul(vx, C1), L::mul(vy, C1));
+		type ix = L::floor(L::add(vx, s));
+		type iy = L::floor(L::add(vy, s));
+		type const t = L::add(L::mul(ix, C0), L::mul(iy, C0));
+		type const x0x = L::add(L::sub(vx, ix), t);
+		type const x0y = L::add(L::sub(vy, iy), t);
+
+		// Other corners
+		typename L::mask const Lower = L::greater(x0x, x0y);
+		type const i1x = L::select(Lower, One, Zero);
+		type const i1y = L::select(Lower, Zero, One);
+		type const x12x = L::sub(L::add(x0x, C0), i1x);
+		type const x12y = L::sub(L::add(x0y, C0), i1y);
+		type const x12z = L::add(x0x, C2);
+		type const x12w = L::add(x0y, C2);
+
+		// Permutations
+		ix = noise_batch_mod289<L>(ix);
+		iy = noise_batch_mod289<L>(iy);
+		type const p0 = noise_batch_permute<L>(L::add(noise_batch_permute<L>(iy), ix));
+		type const p1 = noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(iy, i1y)), ix), i1x));
+		type const p2 = noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(iy, One)), ix), One));
+
+		type m0 = L::max(L::sub(Half, L::add(L::mul(x0x, x0x), L::mul(x0y, x0y))), Zero);
+		type m1 = L::max(L::sub(Half, L::add(L::mul(x12x, x12x), L::mul(x12y, x12y))), Zero);
+		type m2 = L::max(L::sub(Half, L::add(L::mul(x12z, x12z), L::mul(x12w, x12w))), Zero);
+		m0 = L::mul(m0, m0);
+		m1 = L::mul(m1, m1);
+		m2 = L::mul(m2, m2);
+		m0 = L::mul(m0, m0);
+		m1 = L::mul(m1, m1);
+		m2 = L::mul(m2, m2);
+
+		// Gradients: 41 points uniformly over a line, mapped onto a diamond
+		type const TaylorA = L::set1(static_cast<float>(1.79284291400159));
+		type const TaylorB = L::set1(static_cast<float>(0.85373472095314));
+		type g[3];
+		type const p[3] = {p0, p1, p2};
+		type const dx[3] = {x0x, x12x, x12z};
+		type const dy[3] = {x0y, x12y, x12w};
+		type * const m[3] = {&m0, &m1, &m2};
+		for(int k = 0; k < 3; ++k)
+		{
+			type const x = L::sub(L::mul(L::set1(2.0f), noise_batch_fract<L>(L::mul(p[k], C3))), One);
+			type const h = L::sub(L::abs(x), Half);
+			type const ox = L::floor(L::add(x, Half));
+			type const a0 = L::sub(x, ox);
+			*m[k] = L::mul(*m[k], L::sub(TaylorA, L::mul(TaylorB, L::add(L::mul(a0, a0), L::mul(h, h)))));
+			g[k] = L::add(L::mul(a0, dx[k]), L::mul(h, dy[k]));
+		}
+
+		return L::mul(L::set1(130.0f), L::add(L::add(L::mul(m0, g[0]), L::mul(m1, g[1])), L::mul(m2, g[2])));
+	}
+
+	// One corner of 3D simplex: its falloff squared and the gradient picked by
+	// hash p, normalised and dotted with the offset (x, y, z) from that corner
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_simplex3_corner(typename L::type p, typename L::type x, typename L::type y, typename L::type z, typename L::type & m)
+	{
+		typedef typename L::type type;
+		type const Zero = L::set1(0.0f);
+		type const One = L::set1(1.0f);
+		float const n_ = static_cast<float>(0.142857142857);
+		type const NsX = L::set1(n_ * 2.0f - 0.0f);
+		type const NsY = L::set1(n_ * 0.5f - 1.0f);
+		type const NsZ = L::set1(n_ * 1.0f - 0.0f);
+
+		type const j = L::sub(p, L::mul(L::set1(49.0f), L::floor(L::mul(L::mul(p, NsZ), NsZ))));
+		type const x_ = L::floor(L::mul(j, NsZ));
+		type const y_ = L::floor(L::sub(j, L::mul(L::set1(7.0f), x_)));
+		type const gx = L::add(L::mul(x_, NsX), NsY);
+		type const gy = L::add(L::mul(y_, NsX), NsY);
+		type const h = L::sub(L::sub(One, L::abs(gx)), L::abs(gy));
+		type const sh = L::neg(noise_batch_step<L>(h, Zero));
+
+		type const Two = L::set1(2.0f);
+		type const ax = L::add(gx, L::mul(L::add(L::mul(L::floor(gx), Two), One), sh));
+		type const ay = L::add(gy, L::mul(L::add(L::mul(L::floor(gy), Two), One), sh));
+
+		type const norm = noise_batch_taylorInvSqrt<L>(L::add(L::add(L::mul(ax, ax), L::mul(ay, ay)), L::mul(h, h)));
+		type const falloff = L::max(L::sub(L::set1(static_cast<float>(0.6)), L::add(L::add(L::mul(x, x), L::mul(y, y)), L::mul(z, z))), Zero);
+		m = L::mul(falloff, falloff);
+		return L::add(L::add(L::mul(L::mul(ax, norm), x), L::mul(L::mul(ay, norm), y)), L::mul(L::mul(h, norm), z));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type noise_batch_simplex3(typename L::type vx, typename L::type vy, typename L::type vz)
+	{
+		typedef typename L::type type;
+		type const One = L::set1(1.0f);
+		type const Cx = L::set1(static_cast<float>(1.0 / 6.0));
+		type const Cy = L::set1(static_cast<float>(1.0 / 3.0));
+
+		// First corner
+		type const s = L::add(L::add(L::mul(vx, Cy), L::mul(vy, Cy)), L::mul(vz, Cy));
+		type ix = L::floor(L::add(vx, s));
+		type iy = L::floor(L::add(vy, s));
+		type iz = L::floor(L::add(vz, s));
+		type const t = L::add(L::add(L::mul(ix, Cx), L::mul(iy, Cx)), L::mul(iz, Cx));
+		type const x0x = L::add(L::sub(vx, ix), t);
+		type const x0y = L::add(L::sub(vy, iy), t);
+		type const x0z = L::add(L::sub(vz, iz), t);
+
+		// Other corners
+		type const gx = noise_batch_step<L>(x0y, x0x);
+		type const gy = noise_batch_step<L>(x0z, x0y);
+		type const gz = noise_batch_step<L>(x0x, x0z);
+		type const lx = L::sub(One, gx);
+		type const ly = L::sub(One, gy);
+		type const lz = L::sub(One, gz);
+		type const i1x = L::min(gx, lz);
+		type const i1y = L::min(gy, lx);
+		type const i1z = L::min(gz, ly);
+		type const i2x = L::max(gx, lz);
+		type const i2y = L::max(gy, lx);
+		type const i2z = L::max(gz, ly);
+
+		type const Half = L::set1(0.5f);
+		type const x3x = L::sub(x0x, Half);
+		type const x3y = L::sub(x0y, Half);
+		type const x3z = L::sub(x0z, Half);
+
+		// Permutations
+		ix = noise_batch_mod289<L>(ix);
+		iy = noise_batch_mod289<L>(iy);
+		iz = noise_batch_mod289<L>(iz);
+		type const p0 = noise_batch_permute<L>(L::add(noise_batch_permute<L>(L::add(noise_batch_permute<L>(iz), iy)), ix));
+		type const p1 = noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(iz, i1z)), iy), i1y)), ix), i1x));
+		type const p2 = noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(iz, i2z)), iy), i2y)), ix), i2x));
+		type const p3 = noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(L::add(noise_batch_permute<L>(L::add(iz, One)), iy), One)), ix), One));
+
+		// Gradients: 7x7 points over a square, mapped onto an octahedron
+		type m0, m1, m2, m3;
+		type const d0 = noise_batch_simplex3_corner<L>(p0, x0x, x0y, x0z, m0);
+		type const d1 = noise_batch_simplex3_corner<L>(p1, L::add(L::sub(x0x, i1x), Cx), L::add(L::sub(x0y, i1y), Cx), L::add(L::sub(x0z, i1z), Cx), m1);
+		type const d2 = noise_batch_simplex3_corner<L>(p2, L::add(L::sub(x0x, i2x), Cy), L::add(L::sub(x0y, i2y), Cy), L::add(L::sub(x0z, i2z), Cy), m2);
+		type const d3 = noise_batch_simplex3_corner<L>(p3, x3x, x3y, x3z, m3);
+
+		type const Sum01 = L::add(L::mul(L::mul(m0, m0), d0), L::mul(L::mul(m1, m1), d1));
+		type const Sum23 = L::add(L::mul(L::mul(m2, m2), d2), L::mul(L::mul(m3, m3), d3));
+		return L::mul(L::set1(42.0f), L::add(Sum01, Sum23));
+	}
+
+	// Noise bases: the lane kernel for float and the gtc_noise function otherwise
+
+	struct noise_batch_perlin
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static typename L::type call(typename L::type x, typename L::type y)
+		{
+			return noise_batch_perlin2<L>(x, y);
+		}
+
+		template <typename L>
+		GLM_FUNC_QUALIFIER static typename L::type call(typename L::type x, typename L::type y, typename L::type z)
+		{
+			return noise_batch_perlin3<L>(x, y, z);
+		}
+
+		template <typename T, precision P, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static T scalar(vecType<T, P> const & p)
+		{
+			return glm::perlin(p);
+		}
+	};
+
+	struct noise_batch_simplex
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static typename L::type call(typename L::type x, typename L::type y)
+		{
+			return noise_batch_simplex2<L>(x, y);
+		}
+
+		template <typename L>
+		GLM_FUNC_QUALIFIER static typename L::type call(typename L::type x, typename L::type y, typename L::type z)
+		{
+			return noise_batch_simplex3<L>(x, y, z);
+		}
+
+		template <typename T, precision P, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static T scalar(vecType<T, P> const & p)
+		{
+			return glm::simplex(p);
+		}
+	};
+
+	// Each driver handles whole registers from first on and returns where it stopped
+
+	template <typename L, typename N>
+	GLM_FUNC_QUALIFIER std::size_t noise_batch_points(float const * x, float const * y, float * out, std::size_t first, std::size_t count)
+	{
+		std::size_t const Last = count - (count - first) % L::size;
+		std::size_t i = first;
+		for(; i < Last; i += L::size)
+			L::store(out + i, N::template call<L>(L::load(x + i), L::load(y + i)));
+		return i;
+	}
+
+	template <typename L, typename N>
+	GLM_FUNC_QUALIFIER std::size_t noise_batch_points(float const * x, float const * y, float const * z, float * out, std::size_t first, std::size_t count)
+	{
+		std::size_t const Last = count - (count - first) % L::size;
+		std::size_t i = first;
+		for(; i < Last; i += L::size)
+			L::store(out + i, N::template call<L>(L::load(x + i), L::load(y + i), L::load(z + i)));
+		return i;
+	}
+
+	// One row of a fractal grid: x steps along the row, y and z are fixed
+	template <typename L, typename N>
+	GLM_FUNC_QUALIFIER std::size_t noise_batch_fractal_row(float originX, float stepX, float y, int octaves, float lacunarity, float gain, float * out, std::size_t first, std::size_t width)
+	{
+		typedef typename L::type type;
+		std::size_t const Last = width - (width - first) % L::size;
+		std::size_t i = first;
+		for(; i < Last; i += L::size)
+		{
+			type const x = L::add(L::set1(originX), L::mul(L::set1(stepX), L::ramp(static_cast<float>(i))));
+			type Sum = L::set1(0.0f);
+			float Frequency = 1.0f;
+			float Amplitude = 1.0f;
+			for(int o = 0; o < octaves; ++o)
+			{
+				type const Noise = N::template call<L>(L::mul(x, L::set1(Frequency)), L::set1(y * Frequency));
+				Sum = L::add(Sum, L::mul(L::set1(Amplitude), Noise));
+				Frequency *= lacunarity;
+				Amplitude *= gain;
+			}
+			L::store(out + i, Sum);
+		}
+		return i;
+	}
+
+	template <typename L, typename N>
+	GLM_FUNC_QUALIFIER std::size_t noise_batch_fractal_row(float originX, float stepX, float y, float z, int octaves, float lacunarity, float gain, float * out, std::size_t first, std::size_t width)
+	{
+		typedef typename L::type type;
+		std::size_t const Last = width - (width - first) % L::size;
+		std::size_t i = first;
+		for(; i < Last; i += L::size)
+		{
+			type const x = L::add(L::set1(originX), L::mul(L::set1(stepX), L::ramp(static_cast<float>(i))));
+			type Sum = L::set1(0.0f);
+			float Frequency = 1.0f;
+			float Amplitude = 1.0f;
+			for(int o = 0; o < octaves; ++o)
+			{
+				type const Noise = N::template call<L>(L::mul(x, L::set1(Frequency)), L::set1(y * Frequency), L::set1(z * Frequency));
+				Sum = L::add(Sum, L::mul(L::set1(Amplitude), Noise));
+				Frequency *= lacunarity;
+				Amplitude *= gain;
+			}
+			L::store(out + i, Sum);
+		}
+		return i;
+	}
+
+	template <typename T, typename N>
+	struct compute_noise_batch
+	{
+		GLM_FUNC_QUALIFIER static void points(T const * x, T const * y, T * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = N::scalar(tvec2<T, defaultp>(x[i], y[i]));
+		}
+
+		GLM_FUNC_QUALIFIER static void points(T const * x, T const * y, T const * z, T * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = N::scalar(tvec3<T, defaultp>(x[i], y[i], z[i]));
+		}
+
+		template <precision P, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static T fractal_point(vecType<T, P> const & Position, int octaves, T lacunarity, T gain)
+		{
+			T Sum(0);
+			T Frequency(1);
+			T Amplitude(1);
+			for(int o = 0; o < octaves; ++o)
+			{
+				Sum += Amplitude * N::scalar(Position * Frequency);
+				Frequency *= lacunarity;
+				Amplitude *= gain;
+			}
+			return Sum;
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void fractal(tvec2<T, P> const & origin, tvec2<T, P> const & step, int octaves, T lacunarity, T gain, T * out, std::size_t width, std::size_t height)
+		{
+			for(std::size_t j = 0; j < height; ++j)
+			for(std::size_t i = 0; i < width; ++i)
+				out[j * width + i] = fractal_point(origin + step * tvec2<T, P>(static_cast<T>(i), static_cast<T>(j)), octaves, lacunarity, gain);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void fractal(tvec3<T, P> const & origin, tvec3<T, P> const & step, int octaves, T lacunarity, T gain, T * out, std::size_t width, std::size_t height, std::size_t depth)
+		{
+			for(std::size_t k = 0; k < depth; ++k)
+			for(std::size_t j = 0; j < height; ++j)
+			for(std::size_t i = 0; i < width; ++i)
+				out[(k * height + j) * width + i] = fractal_point(origin + step * tvec3<T, P>(static_cast<T>(i), static_cast<T>(j), static_cast<T>(k)), octaves, lacunarity, gain);
+		}
+	};
+
+	// float runs the lane kernels on every architecture: AVX, then SSE2, then
+	// one point at a time for whatever is left
+	template <typename N>
+	struct compute_noise_batch<float, N>
+	{
+		GLM_FUNC_QUALIFIER static void points(float const * x, float const * y, float * out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = noise_batch_points<lanes_avx, N>(x, y, out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = noise_batch_points<lanes_sse, N>(x, y, out, i, count);
+#			endif
+			noise_batch_points<lanes_scalar<float>, N>(x, y, out, i, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void points(float const * x, float const * y, float const * z, float * out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = noise_batch_points<lanes_avx, N>(x, y, z, out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = noise_batch_points<lanes_sse, N>(x, y, z, out, i, count);
+#			endif
+			noise_batch_points<lanes_scalar<float>, N>(x, y, z, out, i, count);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void fractal(tvec2<float, P> const & origin, tvec2<float, P> const & step, int octaves, float lacunarity, float gain, float * out, std::size_t width, std::size_t height)
+		{
+			for(std::size_t j = 0; j < height; ++j)
+			{
+				float const y = origin.y + step.y * static_cast<float>(j);
+				float * const Row = out + j * width;
+				std::size_t i = 0;
+#				if GLM_ARCH & GLM_ARCH_AVX
+					i = noise_batch_fractal_row<lanes_avx, N>(origin.x, step.x, y, octaves, lacunarity, gain, Row, i, width);
+#				endif
+#				if GLM_ARCH & GLM_ARCH_SSE2
+					i = noise_batch_fractal_row<lanes_sse, N>(origin.x, step.x, y, octaves, lacunarity, gain, Row, i, width);
+#				endif
+				noise_batch_fractal_row<lanes_scalar<float>, N>(origin.x, step.x, y, octaves, lacunarity, gain, Row, i, width);
+			}
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void fractal(tvec3<float, P> const & origin, tvec3<float, P> const & step, int octaves, float lacunarity, float gain, float * out, std::size_t width, std::size_t height, std::size_t depth)
+		{
+			for(std::size_t k = 0; k < depth; ++k)
+			for(std::size_t j = 0; j < height; ++j)
+			{
+				float const y = origin.y + step.y * static_cast<float>(j);
+				float const z = origin.z + step.z * static_cast<float>(k);
+				float * const Row = out + (k * height + j) * width;
+				std::size_t i = 0;
+#				if GLM_ARCH & GLM_ARCH_AVX
+					i = noise_batch_fractal_row<lanes_avx, N>(origin.x, step.x, y, z, octaves, lacunarity, gain, Row, i, width);
+#				endif
+#				if GLM_ARCH & GLM_ARCH_SSE2
+					i = noise_batch_fractal_row<lanes_sse, N>(origin.x, step.x, y, z, octaves, lacunarity, gain, Row, i, width);
+#				endif
+				noise_batch_fractal_row<lanes_scalar<float>, N>(origin.x, step.x, y, z, octaves, lacunarity, gain, Row, i, width);
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void perlin
+	(
+		T const * x, T const * y,
+		T * out,
+		std::size_t count
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_perlin>::points(x, y, out, count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void perlin
+	(
+		T const * x, T const * y, T const * z,
+		T * out,
+		std::size_t count
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_perlin>::points(x, y, z, out, count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void simplex
+	(
+		T const * x, T const * y,
+		T * out,
+		std::size_t count
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_simplex>::points(x, y, out, count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void simplex
+	(
+		T const * x, T const * y, T const * z,
+		T * out,
+		std::size_t count
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_simplex>::points(x, y, z, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void perlinFractal
+	(
+		tvec2<T, P> const & origin,
+		tvec2<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_perlin>::fractal(origin, step, octaves, lacunarity, gain, out, width, height);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void perlinFractal
+	(
+		tvec3<T, P> const & origin,
+		tvec3<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height, std::size_t depth
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_perlin>::fractal(origin, step, octaves, lacunarity, gain, out, width, height, depth);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void simplexFractal
+	(
+		tvec2<T, P> const & origin,
+		tvec2<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_simplex>::fractal(origin, step, octaves, lacunarity, gain, out, width, height);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void simplexFractal
+	(
+		tvec3<T, P> const & origin,
+		tvec3<T, P> const & step,
+		int octaves, T lacunarity, T gain,
+		T * out,
+		std::size_t width, std::size_t height, std::size_t depth
+	)
+	{
+		detail::compute_noise_batch<T, detail::noise_batch_simplex>::fractal(origin, step, octaves, lacunarity, gain, out, width, height, depth);
+	}
+}//namespace glm
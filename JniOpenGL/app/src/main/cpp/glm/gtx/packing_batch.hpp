@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.hpp
+/// @date 2026-10-17 / 2026-10-17
+///
+/// @see core (dependence)
+/// @see gtc_packing (dependence)
+///
+/// @defgroup gtx_packing_batch GLM_GTX_packing_batch
+/// @ingroup gtx
+///
+/// @brief Pack and unpack whole arrays of vertex attributes.
+///
+/// Each function applies the gtc_packing function of the same name to count
+/// consecutive values. When GLM_ARCH enables them, SSE2 kernels convert four
+/// values at a time and AVX2 kernels eight; the values left over go through
+/// the gtc_packing functions. Packed results equal the gtc_packing ones bit
+/// for bit, with rounding taken from std::round, and so do unpacked results
+/// except that with F16C, unpackHalf returns signalling NaNs quiet.
+/// NaN inputs to the normalized formats have no defined result.
+///
+/// <glm/gtx/packing_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/packing.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_packing_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_packing_batch
+	/// @{
+
+	/// Converts count floats to 16-bit floats: out[i] = packHalf1x16(in[i]).
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packHalf1x16(float const * in, uint16 * out, std::size_t count);
+
+	/// Converts count 16-bit floats back: out[i] = unpackHalf1x16(in[i]).
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackHalf1x16(uint16 const * in, float * out, std::size_t count);
+
+	/// out[i] = packHalf4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packHalf4x16(vec4 const * in, uint64 * out, std::size_t count);
+
+	/// out[i] = unpackHalf4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackHalf4x16(uint64 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packSnorm1x16(in[i]) for count floats.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packSnorm1x16(float const * in, uint16 * out, std::size_t count);
+
+	/// out[i] = unpackSnorm1x16(in[i]) for count values.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackSnorm1x16(uint16 const * in, float * out, std::size_t count);
+
+	/// out[i] = packSnorm4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packSnorm4x16(vec4 const * in, uint64 * out, std::size_t count);
+
+	/// out[i] = unpackSnorm4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackSnorm4x16(uint64 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packUnorm1x16(in[i]) for count floats.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packUnorm1x16(float const * in, uint16 * out, std::size_t count);
+
+	/// out[i] = unpackUnorm1x16(in[i]) for count values.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackUnorm1x16(uint16 const * in, float * out, std::size_t count);
+
+	/// out[i] = packUnorm4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packUnorm4x16(vec4 const * in, uint64 * out, std::size_t count);
+
+	/// out[i] = unpackUnorm4x16(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackUnorm4x16(uint64 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packSnorm3x10_1x2(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count);
+
+	/// out[i] = unpackSnorm3x10_1x2(in[i]) for count values.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packUnorm3x10_1x2(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count);
+
+	/// out[i] = unpackUnorm3x10_1x2(in[i]) for count values.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count);
+
+	/// out[i] = packF2x11_1x10(in[i]) for count vectors.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void packF2x11_1x10(vec3 const * in, uint32 * out, std::size_t count);
+
+	/// out[i] = unpackF2x11_1x10(in[i]) for count values.
+	///
+	/// @see gtx_packing_batch
+	/// @see gtc_packing
+	GLM_FUNC_DECL void unpackF2x11_1x10(uint32 const * in, vec3 * out, std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "packing_batch.inl"
@@ -0,0 +1,594 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_packing_batch
+/// @file glm/gtx/packing_batch.inl
+/// @date 2026-10-17 / 2026-10-17
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "../detail/_lanes.hpp"
+
+// unpackHalf converts with F16C when the compiler targets it. Every AVX2
+// processor has F16C, but GCC and Clang only allow it with -mf16c.
+#if(GLM_ARCH & GLM_ARCH_AVX) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2)))
+#	define GLM_GTX_PACKING_BATCH_F16C
+#endif
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2
+	// Integer operations and packed memory access on top of the float lanes.
+	// Integer lanes are 32 bits; load16 zero-extends uint16 values into them
+	// and store16 keeps the low 16 bits of each. load4 and store4 move vec4
+	// arrays as one register per component, load3 and store3 vec3 arrays.
+	struct packing_batch_sse : public lanes_sse
+	{
+		typedef __m128i itype;
+
+		GLM_FUNC_QUALIFIER static itype iset1(int s) { return _mm_set1_epi32(s); }
+		GLM_FUNC_QUALIFIER static itype bits(type a) { return _mm_castps_si128(a); }
+		GLM_FUNC_QUALIFIER static type floats(itype a) { return _mm_castsi128_ps(a); }
+		GLM_FUNC_QUALIFIER static itype trunc(type a) { return _mm_cvttps_epi32(a); }
+		GLM_FUNC_QUALIFIER static type convert(itype a) { return _mm_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static mask equal(type a, type b) { return _mm_cmpeq_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask unordered(type a, type b) { return _mm_cmpunord_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask lessEqual(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask greaterEqual(type a, type b) { return _mm_cmpge_ps(a, b); }
+		GLM_FUNC_QUALIFIER static itype iand(itype a, itype b) { return _mm_and_si128(a, b); }
+		GLM_FUNC_QUALIFIER static itype ior(itype a, itype b) { return _mm_or_si128(a, b); }
+		GLM_FUNC_QUALIFIER static itype iadd(itype a, itype b) { return _mm_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype isub(itype a, itype b) { return _mm_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype iequal(itype a, itype b) { return _mm_cmpeq_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype igreater(itype a, itype b) { return _mm_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype iselect(itype m, itype a, itype b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+		GLM_FUNC_QUALIFIER static itype shl(itype a, int n) { return _mm_slli_epi32(a, n); }
+		GLM_FUNC_QUALIFIER static itype shr(itype a, int n) { return _mm_srli_epi32(a, n); }
+		GLM_FUNC_QUALIFIER static itype sar(itype a, int n) { return _mm_srai_epi32(a, n); }
+
+		GLM_FUNC_QUALIFIER static itype load16(uint16 const * p)
+		{
+			return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(p)), _mm_setzero_si128());
+		}
+
+		// Sign-extending the low halves first keeps packs_epi32 from saturating
+		GLM_FUNC_QUALIFIER static void store16(uint16 * p, itype v)
+		{
+			v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm_packs_epi32(v, v));
+		}
+
+		GLM_FUNC_QUALIFIER static itype load32(uint32 const * p) { return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)); }
+		GLM_FUNC_QUALIFIER static void store32(uint32 * p, itype v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+
+		GLM_FUNC_QUALIFIER static void load4(float const * p, type & x, type & y, type & z, type & w)
+		{
+			x = _mm_loadu_ps(p);
+			y = _mm_loadu_ps(p + 4);
+			z = _mm_loadu_ps(p + 8);
+			w = _mm_loadu_ps(p + 12);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+		}
+
+		// p holds x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		GLM_FUNC_QUALIFIER static void load3(float const * p, type & x, type & y, type & z)
+		{
+			__m128 const a = _mm_loadu_ps(p);
+			__m128 const b = _mm_loadu_ps(p + 4);
+			__m128 const c = _mm_loadu_ps(p + 8);
+			x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+		}
+
+		GLM_FUNC_QUALIFIER static void store3(float * p, type x, type y, type z)
+		{
+			_mm_storeu_ps(p, _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+#		ifdef GLM_GTX_PACKING_BATCH_F16C
+			GLM_FUNC_QUALIFIER static type loadHalf(uint16 const * p) { return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(p))); }
+#		endif
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+#if GLM_ARCH & GLM_ARCH_AVX2
+	struct packing_batch_avx2 : public lanes_avx
+	{
+		typedef __m256i itype;
+
+		GLM_FUNC_QUALIFIER static itype iset1(int s) { return _mm256_set1_epi32(s); }
+		GLM_FUNC_QUALIFIER static itype bits(type a) { return _mm256_castps_si256(a); }
+		GLM_FUNC_QUALIFIER static type floats(itype a) { return _mm256_castsi256_ps(a); }
+		GLM_FUNC_QUALIFIER static itype trunc(type a) { return _mm256_cvttps_epi32(a); }
+		GLM_FUNC_QUALIFIER static type convert(itype a) { return _mm256_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static mask equal(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		GLM_FUNC_QUALIFIER static mask unordered(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_UNORD_Q); }
+		GLM_FUNC_QUALIFIER static mask lessEqual(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static mask greaterEqual(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		GLM_FUNC_QUALIFIER static itype iand(itype a, itype b) { return _mm256_and_si256(a, b); }
+		GLM_FUNC_QUALIFIER static itype ior(itype a, itype b) { return _mm256_or_si256(a, b); }
+		GLM_FUNC_QUALIFIER static itype iadd(itype a, itype b) { return _mm256_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype isub(itype a, itype b) { return _mm256_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype iequal(itype a, itype b) { return _mm256_cmpeq_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype igreater(itype a, itype b) { return _mm256_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static itype iselect(itype m, itype a, itype b) { return _mm256_or_si256(_mm256_and_si256(m, a), _mm256_andnot_si256(m, b)); }
+		GLM_FUNC_QUALIFIER static itype shl(itype a, int n) { return _mm256_slli_epi32(a, n); }
+		GLM_FUNC_QUALIFIER static itype shr(itype a, int n) { return _mm256_srli_epi32(a, n); }
+		GLM_FUNC_QUALIFIER static itype sar(itype a, int n) { return _mm256_srai_epi32(a, n); }
+
+		GLM_FUNC_QUALIFIER static itype load16(uint16 const * p)
+		{
+			return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p)));
+		}
+
+		GLM_FUNC_QUALIFIER static void store16(uint16 * p, itype v)
+		{
+			v = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+		}
+
+		GLM_FUNC_QUALIFIER static itype load32(uint32 const * p) { return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)); }
+		GLM_FUNC_QUALIFIER static void store32(uint32 * p, itype v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+
+		// Vectors 0-3 go to the low halves and 4-7 to the high halves, then
+		// each half transposes as in lanes_avx::store4
+		GLM_FUNC_QUALIFIER static void load4(float const * p, type & x, type & y, type & z, type & w)
+		{
+			__m256 const a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 16), 1);
+			__m256 const b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+			__m256 const c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+			__m256 const d = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+			__m256 const ab01 = _mm256_unpacklo_ps(a, b);
+			__m256 const ab23 = _mm256_unpackhi_ps(a, b);
+			__m256 const cd01 = _mm256_unpacklo_ps(c, d);
+			__m256 const cd23 = _mm256_unpackhi_ps(c, d);
+			x = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(1, 0, 1, 0));
+			y = _mm256_shuffle_ps(ab01, cd01, _MM_SHUFFLE(3, 2, 3, 2));
+			z = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(1, 0, 1, 0));
+			w = _mm256_shuffle_ps(ab23, cd23, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		GLM_FUNC_QUALIFIER static void load3(float const * p, type & x, type & y, type & z)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			packing_batch_sse::load3(p, x0, y0, z0);
+			packing_batch_sse::load3(p + 12, x1, y1, z1);
+			x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+			y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+			z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+		}
+
+		GLM_FUNC_QUALIFIER static void store3(float * p, type x, type y, type z)
+		{
+			packing_batch_sse::store3(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+			packing_batch_sse::store3(p + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+		}
+
+#		ifdef GLM_GTX_PACKING_BATCH_F16C
+			GLM_FUNC_QUALIFIER static type loadHalf(uint16 const * p) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p))); }
+#		endif
+	};
+#endif//GLM_ARCH & GLM_ARCH_AVX2
+
+	// std::round: nearest, halfway cases away from zero. v - trunc(v) is
+	// exact, unlike v + 0.5.
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::itype packing_batch_round(typename L::type v)
+	{
+		typename L::itype const t = L::trunc(v);
+		typename L::type const f = L::sub(v, L::convert(t));
+		typename L::itype const Up = L::bits(L::greaterEqual(f, L::set1(0.5f)));
+		typename L::itype const Down = L::bits(L::lessEqual(f, L::set1(-0.5f)));
+		return L::isub(L::iadd(t, Down), Up);
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type packing_batch_clamp(typename L::type v, float minVal, float maxVal)
+	{
+		return L::min(L::max(v, L::set1(minVal)), L::set1(maxVal));
+	}
+
+	// detail::toFloat16 without branches
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::itype packing_batch_toHalf(typename L::type v)
+	{
+		typedef typename L::itype itype;
+		itype const i = L::bits(v);
+		itype const Sign = L::iand(L::shr(i, 16), L::iset1(0x8000));
+		itype const a = L::iand(i, L::iset1(0x7fffffff));
+
+		// Normalized: rebias the exponent, round the 13 dropped bits half up
+		// and let a carry ripple into the exponent; too large becomes infinity
+		itype Half = L::shr(L::iadd(L::isub(a, L::iset1(0x38000000)), L::iset1(0x1000)), 13);
+		Half = L::iselect(L::igreater(Half, L::iset1(0x7bff)), L::iset1(0x7c00), Half);
+
+		// Below the smallest normalized half: count 2^-24 steps, half up
+		itype const Denormal = L::trunc(L::add(L::mul(L::abs(v), L::set1(16777216.0f)), L::set1(0.5f)));
+		Half = L::iselect(L::igreater(L::iset1(0x38800000), a), Denormal, Half);
+
+		// NaN keeps the top of its significand, and at least one bit of it
+		itype const m = L::shr(L::iand(a, L::iset1(0x007fffff)), 13);
+		itype const NaN = L::ior(L::ior(L::iset1(0x7c00), m), L::iand(L::iequal(m, L::iset1(0)), L::iset1(1)));
+		Half = L::iselect(L::igreater(a, L::iset1(0x7f800000)), NaN, Half);
+
+		return L::ior(Sign, Half);
+	}
+
+	// detail::toFloat32 without branches; h holds one half per lane
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type packing_batch_toFloat(typename L::itype h)
+	{
+		typedef typename L::itype itype;
+		itype const Sign = L::shl(L::iand(h, L::iset1(0x8000)), 16);
+		itype const e = L::iand(h, L::iset1(0x7c00));
+		itype const a = L::shl(L::iand(h, L::iset1(0x7fff)), 13);
+		itype const Normal = L::iadd(a, L::iset1(0x38000000));
+		itype const Special = L::iadd(a, L::iset1(0x70000000));
+		itype const Denormal = L::bits(L::mul(L::convert(L::iand(h, L::iset1(0x03ff))), L::set1(5.9604644775390625e-8f))); // 2^-24
+		itype Float = L::iselect(L::iequal(e, L::iset1(0x7c00)), Special, Normal);
+		Float = L::iselect(L::iequal(e, L::iset1(0)), Denormal, Float);
+		return L::floats(L::ior(Float, Sign));
+	}
+
+	// detail::floatTo11bit and floatTo10bit: Shift is 17 for 11 bits and 18
+	// for 10 bits
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::itype packing_batch_toPacked(typename L::type v, int Shift)
+	{
+		typedef typename L::itype itype;
+		int const Exponent = 0x1f << (23 - Shift);
+		int const Mantissa = (1 << (23 - Shift)) - 1;
+		itype const i = L::bits(v);
+		itype Packed = L::ior(
+			L::iand(L::shr(L::isub(L::iand(i, L::iset1(0x7f800000)), L::iset1(0x38000000)), Shift), L::iset1(Exponent)),
+			L::iand(L::shr(i, Shift), L::iset1(Mantissa)));
+		Packed = L::iselect(L::iequal(L::iand(i, L::iset1(0x7fffffff)), L::iset1(0x7f800000)), L::iset1(Exponent), Packed);
+		Packed = L::iselect(L::bits(L::unordered(v, v)), L::iset1(Exponent | Mantissa), Packed);
+		return L::iselect(L::bits(L::equal(v, L::set1(0.0f))), L::iset1(0), Packed);
+	}
+
+	// detail::packed11bitToFloat and packed10bitToFloat on one field per lane
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type packing_batch_fromPacked(typename L::itype p, int Shift)
+	{
+		typedef typename L::itype itype;
+		int const Exponent = 0x1f << (23 - Shift);
+		int const Mantissa = (1 << (23 - Shift)) - 1;
+		itype Float = L::ior(
+			L::iand(L::iadd(L::shl(L::iand(p, L::iset1(Exponent)), Shift), L::iset1(0x38000000)), L::iset1(0x7f800000)),
+			L::shl(L::iand(p, L::iset1(Mantissa)), Shift));
+		Float = L::iselect(L::iequal(p, L::iset1(Exponent)), L::iset1(0x7f800000), Float);
+		Float = L::iselect(L::iequal(p, L::iset1(Exponent | Mantissa)), L::iset1(0x7fc00000), Float);
+		return L::floats(L::iselect(L::iequal(p, L::iset1(0)), L::iset1(0), Float));
+	}
+
+	// Each operation converts L::size values starting at in and out
+
+	struct packing_batch_packHalf
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(float const * in, uint16 * out)
+		{
+			L::store16(out, packing_batch_toHalf<L>(L::load(in)));
+		}
+	};
+
+	struct packing_batch_unpackHalf
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint16 const * in, float * out)
+		{
+#			ifdef GLM_GTX_PACKING_BATCH_F16C
+				L::store(out, L::loadHalf(in));
+#			else
+				L::store(out, packing_batch_toFloat<L>(L::load16(in)));
+#			endif
+		}
+	};
+
+	struct packing_batch_packSnorm16
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(float const * in, uint16 * out)
+		{
+			L::store16(out, packing_batch_round<L>(L::mul(packing_batch_clamp<L>(L::load(in), -1.0f, 1.0f), L::set1(32767.0f))));
+		}
+	};
+
+	struct packing_batch_unpackSnorm16
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint16 const * in, float * out)
+		{
+			typename L::type const Unpack = L::convert(L::sar(L::shl(L::load16(in), 16), 16));
+			L::store(out, packing_batch_clamp<L>(L::mul(Unpack, L::set1(3.0518509475997192297128208258309e-5f)), -1.0f, 1.0f)); // 1.0f / 32767.0f
+		}
+	};
+
+	struct packing_batch_packUnorm16
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(float const * in, uint16 * out)
+		{
+			L::store16(out, packing_batch_round<L>(L::mul(packing_batch_clamp<L>(L::load(in), 0.0f, 1.0f), L::set1(65535.0f))));
+		}
+	};
+
+	struct packing_batch_unpackUnorm16
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint16 const * in, float * out)
+		{
+			L::store(out, L::mul(L::convert(L::load16(in)), L::set1(1.5259021896696421759365224689097e-5f))); // 1.0 / 65535.0
+		}
+	};
+
+	struct packing_batch_packSnorm3x10_1x2
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(vec4 const * in, uint32 * out)
+		{
+			typename L::type x, y, z, w;
+			L::load4(&in[0].x, x, y, z, w);
+			typename L::itype const Mask = L::iset1(0x3ff);
+			typename L::itype const X = L::iand(packing_batch_round<L>(L::mul(packing_batch_clamp<L>(x, -1.0f, 1.0f), L::set1(511.f))), Mask);
+			typename L::itype const Y = L::iand(packing_batch_round<L>(L::mul(packing_batch_clamp<L>(y, -1.0f, 1.0f), L::set1(511.f))), Mask);
+			typename L::itype const Z = L::iand(packing_batch_round<L>(L::mul(packing_batch_clamp<L>(z, -1.0f, 1.0f), L::set1(511.f))), Mask);
+			typename L::itype const W = packing_batch_round<L>(packing_batch_clamp<L>(w, -1.0f, 1.0f));
+			L::store32(out, L::ior(L::ior(X, L::shl(Y, 10)), L::ior(L::shl(Z, 20), L::shl(W, 30))));
+		}
+	};
+
+	struct packing_batch_unpackSnorm3x10_1x2
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint32 const * in, vec4 * out)
+		{
+			typename L::itype const v = L::load32(in);
+			typename L::type const Scale = L::set1(511.f);
+			typename L::type const x = packing_batch_clamp<L>(L::div(L::convert(L::sar(L::shl(v, 22), 22)), Scale), -1.0f, 1.0f);
+			typename L::type const y = packing_batch_clamp<L>(L::div(L::convert(L::sar(L::shl(v, 12), 22)), Scale), -1.0f, 1.0f);
+			typename L::type const z = packing_batch_clamp<L>(L::div(L::convert(L::sar(L::shl(v, 2), 22)), Scale), -1.0f, 1.0f);
+			typename L::type const w = packing_batch_clamp<L>(L::convert(L::sar(v, 30)), -1.0f, 1.0f);
+			L::store4(&out[0].x, 4, x, y, z, w);
+		}
+	};
+
+	struct packing_batch_packUnorm3x10_1x2
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(vec4 const * in, uint32 * out)
+		{
+			typename L::type x, y, z, w;
+			L::load4(&in[0].x, x, y, z, w);
+			typename L::itype const X = packing_batch_round<L>(L::mul(packing_batch_clamp<L>(x, 0.0f, 1.0f), L::set1(1023.f)));
+			typename L::itype const Y = packing_batch_round<L>(L::mul(packing_batch_clamp<L>(y, 0.0f, 1.0f), L::set1(1023.f)));
+			typename L::itype const Z = packing_batch_round<L>(L::mul(packing_batch_clamp<L>(z, 0.0f, 1.0f), L::set1(1023.f)));
+			typename L::itype const W = packing_batch_round<L>(L::mul(packing_batch_clamp<L>(w, 0.0f, 1.0f), L::set1(3.f)));
+			L::store32(out, L::ior(L::ior(X, L::shl(Y, 10)), L::ior(L::shl(Z, 20), L::shl(W, 30))));
+		}
+	};
+
+	struct packing_batch_unpackUnorm3x10_1x2
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint32 const * in, vec4 * out)
+		{
+			typename L::itype const v = L::load32(in);
+			typename L::itype const Mask = L::iset1(0x3ff);
+			typename L::type const Scale = L::set1(1023.f);
+			typename L::type const x = L::div(L::convert(L::iand(v, Mask)), Scale);
+			typename L::type const y = L::div(L::convert(L::iand(L::shr(v, 10), Mask)), Scale);
+			typename L::type const z = L::div(L::convert(L::iand(L::shr(v, 20), Mask)), Scale);
+			typename L::type const w = L::div(L::convert(L::shr(v, 30)), L::set1(3.f));
+			L::store4(&out[0].x, 4, x, y, z, w);
+		}
+	};
+
+	struct packing_batch_packF2x11_1x10
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(vec3 const * in, uint32 * out)
+		{
+			typename L::type x, y, z;
+			L::load3(&in[0].x, x, y, z);
+			L::store32(out, L::ior(
+				L::ior(packing_batch_toPacked<L>(x, 17), L::shl(packing_batch_toPacked<L>(y, 17), 11)),
+				L::shl(packing_batch_toPacked<L>(z, 18), 22)));
+		}
+	};
+
+	struct packing_batch_unpackF2x11_1x10
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static void call(uint32 const * in, vec3 * out)
+		{
+			typename L::itype const v = L::load32(in);
+			typename L::itype const Mask = L::iset1(0x7ff);
+			L::store3(&out[0].x,
+				packing_batch_fromPacked<L>(L::iand(v, Mask), 17),
+				packing_batch_fromPacked<L>(L::iand(L::shr(v, 11), Mask), 17),
+				packing_batch_fromPacked<L>(L::shr(v, 22), 18));
+		}
+	};
+
+	template <typename L, typename Op, typename In, typename Out>
+	GLM_FUNC_QUALIFIER std::size_t packing_batch_loop(In const * in, Out * out, std::size_t first, std::size_t count)
+	{
+		std::size_t const Last = count - (count - first) % L::size;
+		std::size_t i = first;
+		for(; i < Last; i += L::size)
+			Op::template call<L>(in + i, out + i);
+		return i;
+	}
+
+	// Runs Op over whole registers and returns how many values it converted
+#if GLM_ARCH & GLM_ARCH_SSE2
+	template <typename Op, typename In, typename Out>
+	GLM_FUNC_QUALIFIER std::size_t packing_batch(In const * in, Out * out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2
+			i = packing_batch_loop<packing_batch_avx2, Op>(in, out, i, count);
+#		endif
+		return packing_batch_loop<packing_batch_sse, Op>(in, out, i, count);
+	}
+#else
+	template <typename Op, typename In, typename Out>
+	GLM_FUNC_QUALIFIER std::size_t packing_batch(In const *, Out *, std::size_t)
+	{
+		return 0;
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void packHalf1x16(float const * in, uint16 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packHalf>(in, out, count); i < count; ++i)
+			out[i] = packHalf1x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf1x16(uint16 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackHalf>(in, out, count); i < count; ++i)
+			out[i] = unpackHalf1x16(in[i]);
+	}
+
+	// The 4x16 formats pack component by component, so the kernels run on
+	// the components; registers hold a multiple of four, leaving whole
+	// vectors for the scalar loop.
+
+	GLM_FUNC_QUALIFIER void packHalf4x16(vec4 const * in, uint64 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_packHalf>(
+			reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = packHalf4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf4x16(uint64 const * in, vec4 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_unpackHalf>(
+			reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = unpackHalf4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16(float const * in, uint16 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packSnorm16>(in, out, count); i < count; ++i)
+			out[i] = packSnorm1x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16(uint16 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackSnorm16>(in, out, count); i < count; ++i)
+			out[i] = unpackSnorm1x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x16(vec4 const * in, uint64 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_packSnorm16>(
+			reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = packSnorm4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x16(uint64 const * in, vec4 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_unpackSnorm16>(
+			reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = unpackSnorm4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16(float const * in, uint16 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packUnorm16>(in, out, count); i < count; ++i)
+			out[i] = packUnorm1x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16(uint16 const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackUnorm16>(in, out, count); i < count; ++i)
+			out[i] = unpackUnorm1x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x16(vec4 const * in, uint64 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_packUnorm16>(
+			reinterpret_cast<float const *>(in), reinterpret_cast<uint16 *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = packUnorm4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x16(uint64 const * in, vec4 * out, std::size_t count)
+	{
+		std::size_t const First = detail::packing_batch<detail::packing_batch_unpackUnorm16>(
+			reinterpret_cast<uint16 const *>(in), reinterpret_cast<float *>(out), count * 4) / 4;
+		for(std::size_t i = First; i < count; ++i)
+			out[i] = unpackUnorm4x16(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packSnorm3x10_1x2>(in, out, count); i < count; ++i)
+			out[i] = packSnorm3x10_1x2(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackSnorm3x10_1x2>(in, out, count); i < count; ++i)
+			out[i] = unpackSnorm3x10_1x2(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const * in, uint32 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packUnorm3x10_1x2>(in, out, count); i < count; ++i)
+			out[i] = packUnorm3x10_1x2(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const * in, vec4 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackUnorm3x10_1x2>(in, out, count); i < count; ++i)
+			out[i] = unpackUnorm3x10_1x2(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const * in, uint32 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_packF2x11_1x10>(in, out, count); i < count; ++i)
+			out[i] = packF2x11_1x10(in[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const * in, vec3 * out, std::size_t count)
+	{
+		for(std::size_t i = detail::packing_batch<detail::packing_batch_unpackF2x11_1x10>(in, out, count); i < count; ++i)
+			out[i] = unpackF2x11_1x10(in[i]);
+	}
+}//namespace glm
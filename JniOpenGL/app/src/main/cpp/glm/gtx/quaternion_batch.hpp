@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+/// @date 2026-10-17 / 2026-10-17
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// @brief Slerp, multiply and convert whole arrays of quaternions.
+///
+/// Quaternions are passed as one array per component (tquat_soa), so that
+/// float arrays run on SSE2 kernels four quaternions at a time, or AVX
+/// kernels eight at a time, when GLM_ARCH enables them.
+///
+/// For float, slerp replaces acos and sin with polynomials: acos from
+/// Abramowitz and Stegun 4.4.46, sin as a degree 11 odd polynomial after
+/// reducing the argument by pi. Results stay within 1e-6 of slerp for unit
+/// quaternions and interpolation factors in [-4, 4], and the last elements
+/// of an array, which don't fill a register, go through the same
+/// polynomials so they round like the rest. multiply and the matrix
+/// conversions use the formulas of gtc_quaternion in the same order and
+/// match it bit for bit unless the compiler fuses scalar multiply-adds.
+/// Other value types call the gtc_quaternion functions element by element.
+///
+/// Outputs may be the same arrays as inputs but must not otherwise overlap.
+///
+/// <glm/gtx/quaternion_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Quaternion arrays, one array per component. Use T const for inputs:
+	/// tquat_soa<float const> In = {x, y, z, w};
+	///
+	/// @see gtx_quaternion_batch
+	template <typename T>
+	struct tquat_soa
+	{
+		T * x;
+		T * y;
+		T * z;
+		T * w;
+	};
+
+	/// Vector arrays, one array per component.
+	///
+	/// @see gtx_quaternion_batch
+	template <typename T>
+	struct tvec3_soa
+	{
+		T * x;
+		T * y;
+		T * z;
+	};
+
+	/// Short path spherical linear interpolation of count pairs:
+	/// out[i] = slerp(x[i], y[i], a[i]).
+	///
+	/// @see gtx_quaternion_batch
+	/// @see gtc_quaternion
+	template <typename T>
+	GLM_FUNC_DECL void slerp(
+		tquat_soa<T const> const & x,
+		tquat_soa<T const> const & y,
+		T const * a,
+		tquat_soa<T> const & out,
+		std::size_t count);
+
+	/// Multiplies count pairs: out[i] = p[i] * q[i].
+	///
+	/// @see gtx_quaternion_batch
+	template <typename T>
+	GLM_FUNC_DECL void multiply(
+		tquat_soa<T const> const & p,
+		tquat_soa<T const> const & q,
+		tquat_soa<T> const & out,
+		std::size_t count);
+
+	/// Builds count rigid transforms: out[i] is mat4_cast(q[i]) with
+	/// translation t[i] in its last column.
+	///
+	/// @see gtx_quaternion_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void mat4_cast(
+		tquat_soa<T const> const & q,
+		tvec3_soa<T const> const & t,
+		tmat4x4<T, P> * out,
+		std::size_t count);
+
+	/// Builds count rigid transforms in the three vec4 layout skinning shaders
+	/// take: column r of out[i] is row r of the mat4_cast overload's result,
+	/// so a GLSL mat3x4 uniform applies it as vec4(v, 1) * m.
+	///
+	/// @see gtx_quaternion_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void mat3x4_cast(
+		tquat_soa<T const> const & q,
+		tvec3_soa<T const> const & t,
+		tmat3x4<T, P> * out,
+		std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,393 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.inl
+/// @date 2026-10-17 / 2026-10-17
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "../detail/_lanes.hpp"
+
+namespace glm{
+namespace detail
+{
+	// acos on [0, 1] as sqrt(1 - x) times a degree 7 polynomial,
+	// Abramowitz and Stegun 4.4.46, absolute error below 2e-8
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type quaternion_batch_acos(typename L::type x)
+	{
+		typedef typename L::type type;
+		type p = L::set1(-0.0012624911f);
+		p = L::add(L::mul(p, x), L::set1(0.0066700901f));
+		p = L::add(L::mul(p, x), L::set1(-0.0170881256f));
+		p = L::add(L::mul(p, x), L::set1(0.0308918810f));
+		p = L::add(L::mul(p, x), L::set1(-0.0501743046f));
+		p = L::add(L::mul(p, x), L::set1(0.0889789874f));
+		p = L::add(L::mul(p, x), L::set1(-0.2145988016f));
+		p = L::add(L::mul(p, x), L::set1(1.5707963050f));
+		return L::mul(L::sqrt(L::sub(L::set1(1.0f), x)), p);
+	}
+
+	// sin: take off the nearest multiple k of pi, with pi split in two so that
+	// x - k * pi stays exact, evaluate the Taylor polynomial to degree 11 on
+	// what is left in [-pi/2, pi/2] and flip the sign for odd k
+	template <typename L>
+	GLM_FUNC_QUALIFIER typename L::type quaternion_batch_sin(typename L::type x)
+	{
+		typedef typename L::type type;
+		type const k = L::round(L::mul(x, L::set1(0.318309886f)));
+		type const r = L::sub(L::sub(x, L::mul(k, L::set1(3.140625f))), L::mul(k, L::set1(9.67653589793e-4f)));
+		type const r2 = L::mul(r, r);
+
+		type p = L::set1(-2.5052108e-8f);
+		p = L::add(L::mul(p, r2), L::set1(2.7557319e-6f));
+		p = L::add(L::mul(p, r2), L::set1(-1.9841270e-4f));
+		p = L::add(L::mul(p, r2), L::set1(8.3333333e-3f));
+		p = L::add(L::mul(p, r2), L::set1(-1.6666667e-1f));
+		type const s = L::add(r, L::mul(L::mul(r, r2), p));
+
+		// k - 2 * round(k / 2) is 0 for even k and -1 or 1 for odd k
+		type const d = L::sub(k, L::mul(L::set1(2.0f), L::round(L::mul(k, L::set1(0.5f)))));
+		return L::mul(s, L::sub(L::set1(1.0f), L::mul(L::set1(2.0f), L::mul(d, d))));
+	}
+
+	// Each driver handles whole registers from first on and returns where it stopped
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER std::size_t quaternion_batch_slerp(tquat_soa<float const> const & x, tquat_soa<float const> const & y, float const * a, tquat_soa<float> const & out, std::size_t first, std::size_t count)
+	{
+		typedef typename L::type type;
+		typedef typename L::mask mask;
+		type const Zero = L::set1(0.0f);
+		type const One = L::set1(1.0f);
+		type const Threshold = L::set1(1.0f - epsilon<float>());
+
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			type const xx = L::load(x.x + i);
+			type const xy = L::load(x.y + i);
+			type const xz = L::load(x.z + i);
+			type const xw = L::load(x.w + i);
+			type zx = L::load(y.x + i);
+			type zy = L::load(y.y + i);
+			type zz = L::load(y.z + i);
+			type zw = L::load(y.w + i);
+			type const A = L::load(a + i);
+
+			type CosTheta = L::add(L::add(L::mul(xx, zx), L::mul(xy, zy)), L::add(L::mul(xz, zz), L::mul(xw, zw)));
+
+			// Negate one side where the interpolation would take the long way around
+			mask const Flip = L::less(CosTheta, Zero);
+			zx = L::select(Flip, L::neg(zx), zx);
+			zy = L::select(Flip, L::neg(zy), zy);
+			zz = L::select(Flip, L::neg(zz), zz);
+			zw = L::select(Flip, L::neg(zw), zw);
+			CosTheta = L::select(Flip, L::neg(CosTheta), CosTheta);
+
+			// Nearly equal rotations mix linearly, as slerp does, instead of
+			// dividing by a vanishing sin(angle); the sin terms of those lanes
+			// are computed anyway and discarded
+			mask const Linear = L::greater(CosTheta, Threshold);
+			type const Angle = quaternion_batch_acos<L>(CosTheta);
+			type const SinAngle = quaternion_batch_sin<L>(Angle);
+			type const SinX = quaternion_batch_sin<L>(L::mul(L::sub(One, A), Angle));
+			type const SinZ = quaternion_batch_sin<L>(L::mul(A, Angle));
+
+			L::store(out.x + i, L::select(Linear, L::add(xx, L::mul(A, L::sub(zx, xx))), L::div(L::add(L::mul(SinX, xx), L::mul(SinZ, zx)), SinAngle)));
+			L::store(out.y + i, L::select(Linear, L::add(xy, L::mul(A, L::sub(zy, xy))), L::div(L::add(L::mul(SinX, xy), L::mul(SinZ, zy)), SinAngle)));
+			L::store(out.z + i, L::select(Linear, L::add(xz, L::mul(A, L::sub(zz, xz))), L::div(L::add(L::mul(SinX, xz), L::mul(SinZ, zz)), SinAngle)));
+			L::store(out.w + i, L::select(Linear, L::add(xw, L::mul(A, L::sub(zw, xw))), L::div(L::add(L::mul(SinX, xw), L::mul(SinZ, zw)), SinAngle)));
+		}
+		return i;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER std::size_t quaternion_batch_multiply(tquat_soa<float const> const & p, tquat_soa<float const> const & q, tquat_soa<float> const & out, std::size_t first, std::size_t count)
+	{
+		typedef typename L::type type;
+
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			type const px = L::load(p.x + i);
+			type const py = L::load(p.y + i);
+			type const pz = L::load(p.z + i);
+			type const pw = L::load(p.w + i);
+			type const qx = L::load(q.x + i);
+			type const qy = L::load(q.y + i);
+			type const qz = L::load(q.z + i);
+			type const qw = L::load(q.w + i);
+
+			L::store(out.w + i, L::sub(L::sub(L::sub(L::mul(pw, qw), L::mul(px, qx)), L::mul(py, qy)), L::mul(pz, qz)));
+			L::store(out.x + i, L::sub(L::add(L::add(L::mul(pw, qx), L::mul(px, qw)), L::mul(py, qz)), L::mul(pz, qy)));
+			L::store(out.y + i, L::sub(L::add(L::add(L::mul(pw, qy), L::mul(py, qw)), L::mul(pz, qx)), L::mul(px, qz)));
+			L::store(out.z + i, L::sub(L::add(L::add(L::mul(pw, qz), L::mul(pz, qw)), L::mul(px, qy)), L::mul(py, qx)));
+		}
+		return i;
+	}
+
+	// The mat3_cast entries m[column][row] of one register of quaternions
+	template <typename L>
+	struct quaternion_batch_rotation
+	{
+		typedef typename L::type type;
+
+		GLM_FUNC_QUALIFIER quaternion_batch_rotation(tquat_soa<float const> const & q, std::size_t i)
+		{
+			type const x = L::load(q.x + i);
+			type const y = L::load(q.y + i);
+			type const z = L::load(q.z + i);
+			type const w = L::load(q.w + i);
+			type const One = L::set1(1.0f);
+			type const Two = L::set1(2.0f);
+
+			type const qxx = L::mul(x, x);
+			type const qyy = L::mul(y, y);
+			type const qzz = L::mul(z, z);
+			type const qxz = L::mul(x, z);
+			type const qxy = L::mul(x, y);
+			type const qyz = L::mul(y, z);
+			type const qwx = L::mul(w, x);
+			type const qwy = L::mul(w, y);
+			type const qwz = L::mul(w, z);
+
+			m[0][0] = L::sub(One, L::mul(Two, L::add(qyy, qzz)));
+			m[0][1] = L::mul(Two, L::add(qxy, qwz));
+			m[0][2] = L::mul(Two, L::sub(qxz, qwy));
+
+			m[1][0] = L::mul(Two, L::sub(qxy, qwz));
+			m[1][1] = L::sub(One, L::mul(Two, L::add(qxx, qzz)));
+			m[1][2] = L::mul(Two, L::add(qyz, qwx));
+
+			m[2][0] = L::mul(Two, L::add(qxz, qwy));
+			m[2][1] = L::mul(Two, L::sub(qyz, qwx));
+			m[2][2] = L::sub(One, L::mul(Two, L::add(qxx, qyy)));
+		}
+
+		type m[3][3];
+	};
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER std::size_t quaternion_batch_mat4(tquat_soa<float const> const & q, tvec3_soa<float const> const & t, float * out, std::size_t first, std::size_t count)
+	{
+		typedef typename L::type type;
+		type const Zero = L::set1(0.0f);
+		type const One = L::set1(1.0f);
+
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			quaternion_batch_rotation<L> const R(q, i);
+			float * const Out = out + i * 16;
+			L::store4(Out, 16, R.m[0][0], R.m[0][1], R.m[0][2], Zero);
+			L::store4(Out + 4, 16, R.m[1][0], R.m[1][1], R.m[1][2], Zero);
+			L::store4(Out + 8, 16, R.m[2][0], R.m[2][1], R.m[2][2], Zero);
+			L::store4(Out + 12, 16, L::load(t.x + i), L::load(t.y + i), L::load(t.z + i), One);
+		}
+		return i;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER std::size_t quaternion_batch_mat3x4(tquat_soa<float const> const & q, tvec3_soa<float const> const & t, float * out, std::size_t first, std::size_t count)
+	{
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			quaternion_batch_rotation<L> const R(q, i);
+			float * const Out = out + i * 12;
+			L::store4(Out, 12, R.m[0][0], R.m[1][0], R.m[2][0], L::load(t.x + i));
+			L::store4(Out + 4, 12, R.m[0][1], R.m[1][1], R.m[2][1], L::load(t.y + i));
+			L::store4(Out + 8, 12, R.m[0][2], R.m[1][2], R.m[2][2], L::load(t.z + i));
+		}
+		return i;
+	}
+
+	template <typename T>
+	struct compute_quaternion_batch
+	{
+		GLM_FUNC_QUALIFIER static void slerp(tquat_soa<T const> const & x, tquat_soa<T const> const & y, T const * a, tquat_soa<T> const & out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tquat<T, defaultp> const Result = glm::slerp(
+					tquat<T, defaultp>(x.w[i], x.x[i], x.y[i], x.z[i]),
+					tquat<T, defaultp>(y.w[i], y.x[i], y.y[i], y.z[i]),
+					a[i]);
+				out.x[i] = Result.x;
+				out.y[i] = Result.y;
+				out.z[i] = Result.z;
+				out.w[i] = Result.w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tquat_soa<T const> const & p, tquat_soa<T const> const & q, tquat_soa<T> const & out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tquat<T, defaultp> const Result =
+					tquat<T, defaultp>(p.w[i], p.x[i], p.y[i], p.z[i]) *
+					tquat<T, defaultp>(q.w[i], q.x[i], q.y[i], q.z[i]);
+				out.x[i] = Result.x;
+				out.y[i] = Result.y;
+				out.z[i] = Result.z;
+				out.w[i] = Result.w;
+			}
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void to_mat4(tquat_soa<T const> const & q, tvec3_soa<T const> const & t, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tmat4x4<T, P> Result(glm::mat4_cast(tquat<T, P>(q.w[i], q.x[i], q.y[i], q.z[i])));
+				Result[3] = tvec4<T, P>(t.x[i], t.y[i], t.z[i], static_cast<T>(1));
+				out[i] = Result;
+			}
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void to_mat3x4(tquat_soa<T const> const & q, tvec3_soa<T const> const & t, tmat3x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tmat3x3<T, P> const R(glm::mat3_cast(tquat<T, P>(q.w[i], q.x[i], q.y[i], q.z[i])));
+				out[i] = tmat3x4<T, P>(
+					tvec4<T, P>(R[0][0], R[1][0], R[2][0], t.x[i]),
+					tvec4<T, P>(R[0][1], R[1][1], R[2][1], t.y[i]),
+					tvec4<T, P>(R[0][2], R[1][2], R[2][2], t.z[i]));
+			}
+		}
+	};
+
+	// float runs the lane kernels on every architecture: AVX, then SSE2, then
+	// one element at a time for whatever is left
+	template <>
+	struct compute_quaternion_batch<float>
+	{
+		GLM_FUNC_QUALIFIER static void slerp(tquat_soa<float const> const & x, tquat_soa<float const> const & y, float const * a, tquat_soa<float> const & out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = quaternion_batch_slerp<lanes_avx>(x, y, a, out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = quaternion_batch_slerp<lanes_sse>(x, y, a, out, i, count);
+#			endif
+			quaternion_batch_slerp<lanes_scalar<float> >(x, y, a, out, i, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tquat_soa<float const> const & p, tquat_soa<float const> const & q, tquat_soa<float> const & out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = quaternion_batch_multiply<lanes_avx>(p, q, out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = quaternion_batch_multiply<lanes_sse>(p, q, out, i, count);
+#			endif
+			quaternion_batch_multiply<lanes_scalar<float> >(p, q, out, i, count);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void to_mat4(tquat_soa<float const> const & q, tvec3_soa<float const> const & t, tmat4x4<float, P> * out, std::size_t count)
+		{
+			float * const Out = reinterpret_cast<float *>(out);
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = quaternion_batch_mat4<lanes_avx>(q, t, Out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = quaternion_batch_mat4<lanes_sse>(q, t, Out, i, count);
+#			endif
+			quaternion_batch_mat4<lanes_scalar<float> >(q, t, Out, i, count);
+		}
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER static void to_mat3x4(tquat_soa<float const> const & q, tvec3_soa<float const> const & t, tmat3x4<float, P> * out, std::size_t count)
+		{
+			float * const Out = reinterpret_cast<float *>(out);
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = quaternion_batch_mat3x4<lanes_avx>(q, t, Out, i, count);
+#			endif
+#			if GLM_ARCH & GLM_ARCH_SSE2
+				i = quaternion_batch_mat3x4<lanes_sse>(q, t, Out, i, count);
+#			endif
+			quaternion_batch_mat3x4<lanes_scalar<float> >(q, t, Out, i, count);
+		}
+	};
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void slerp
+	(
+		tquat_soa<T const> const & x,
+		tquat_soa<T const> const & y,
+		T const * a,
+		tquat_soa<T> const & out,
+		std::size_t count
+	)
+	{
+		detail::compute_quaternion_batch<T>::slerp(x, y, a, out, count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void multiply
+	(
+		tquat_soa<T const> const & p,
+		tquat_soa<T const> const & q,
+		tquat_soa<T> const & out,
+		std::size_t count
+	)
+	{
+		detail::compute_quaternion_batch<T>::multiply(p, q, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void mat4_cast
+	(
+		tquat_soa<T const> const & q,
+		tvec3_soa<T const> const & t,
+		tmat4x4<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_quaternion_batch<T>::template to_mat4<P>(q, t, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void mat3x4_cast
+	(
+		tquat_soa<T const> const & q,
+		tvec3_soa<T const> const & t,
+		tmat3x4<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_quaternion_batch<T>::template to_mat3x4<P>(q, t, out, count);
+	}
+}//namespace glm
@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_transform_batch
+/// @file glm/gtx/transform_batch.hpp
+/// @date 2026-10-17 / 2026-10-17
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_batch GLM_GTX_transform_batch
+/// @ingroup gtx
+///
+/// @brief Transform whole arrays of points and vectors by one matrix.
+///
+/// Arrays come either interleaved (AoS, tvec3 or tvec4 elements) or as one
+/// array per component (SoA). float arrays run on SSE2 kernels four elements
+/// at a time, or AVX kernels eight at a time, when GLM_ARCH enables them.
+/// Sums run in the order tmat4x4 * tvec4 uses, so results match the scalar
+/// functions bit for bit unless the compiler fuses scalar multiply-adds.
+/// Input and output may be the same array but must not otherwise overlap.
+///
+/// <glm/gtx/transform_batch.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_transform_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_batch
+	/// @{
+
+	/// Transforms count points: out[i] = tvec3(m * tvec4(in[i], 1)).
+	/// The matrix is taken as affine; its last row is ignored.
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count);
+
+	/// Transforms count homogeneous vectors: out[i] = m * in[i].
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(
+		tmat4x4<T, P> const & m,
+		tvec4<T, P> const * in,
+		tvec4<T, P> * out,
+		std::size_t count);
+
+	/// Transforms count directions: out[i] = tvec3(m * tvec4(in[i], 0)).
+	/// Translation does not apply to directions.
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformVectors(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count);
+
+	/// Transforms count points through a projective matrix and divides by w:
+	/// out[i] = tvec3(r) / r.w where r = m * tvec4(in[i], 1).
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void projectPoints(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count);
+
+	/// transformPoints on component arrays: (outX[i], outY[i], outZ[i]) is
+	/// point (inX[i], inY[i], inZ[i]) transformed by m.
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPoints(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count);
+
+	/// transformVectors on component arrays.
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformVectors(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count);
+
+	/// projectPoints on component arrays.
+	///
+	/// @see gtx_transform_batch
+	template <typename T, precision P>
+	GLM_FUNC_DECL void projectPoints(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "transform_batch.inl"
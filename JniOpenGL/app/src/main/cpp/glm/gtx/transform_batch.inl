@@ -0,0 +1,435 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// Restrictions:
+///		By making use of the Software for military purposes, you choose to make
+///		a Bunny unhappy.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_transform_batch
+/// @file glm/gtx/transform_batch.inl
+/// @date 2026-10-17 / 2026-10-17
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "../detail/_lanes.hpp"
+
+namespace glm{
+namespace detail
+{
+	enum transform_batch_mode
+	{
+		transform_batch_point,
+		transform_batch_vector,
+		transform_batch_projective
+	};
+
+	// One row of m * (x, y, z, w), summed in the order tmat4x4 * tvec4 uses,
+	// so the scalar and SIMD paths round identically
+	template <transform_batch_mode Mode, typename T, precision P>
+	GLM_FUNC_QUALIFIER T transform_batch_row(tmat4x4<T, P> const & m, length_t r, T x, T y, T z)
+	{
+		T const XY = m[0][r] * x + m[1][r] * y;
+		return Mode == transform_batch_vector ? XY + m[2][r] * z : XY + (m[2][r] * z + m[3][r]);
+	}
+
+	template <transform_batch_mode Mode, typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform_batch_xyz(tmat4x4<T, P> const & m, T & x, T & y, T & z)
+	{
+		T const X = transform_batch_row<Mode>(m, 0, x, y, z);
+		T const Y = transform_batch_row<Mode>(m, 1, x, y, z);
+		T const Z = transform_batch_row<Mode>(m, 2, x, y, z);
+		if(Mode == transform_batch_projective)
+		{
+			T const W = transform_batch_row<Mode>(m, 3, x, y, z);
+			x = X / W;
+			y = Y / W;
+			z = Z / W;
+		}
+		else
+		{
+			x = X;
+			y = Y;
+			z = Z;
+		}
+	}
+
+	template <transform_batch_mode Mode, typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform_batch_aos3(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x = in[i].x, y = in[i].y, z = in[i].z;
+			transform_batch_xyz<Mode>(m, x, y, z);
+			out[i] = tvec3<T, P>(x, y, z);
+		}
+	}
+
+	template <transform_batch_mode Mode, typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform_batch_soa(tmat4x4<T, P> const & m, T const * inX, T const * inY, T const * inZ, T * outX, T * outY, T * outZ, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T x = inX[i], y = inY[i], z = inZ[i];
+			transform_batch_xyz<Mode>(m, x, y, z);
+			outX[i] = x;
+			outY[i] = y;
+			outZ[i] = z;
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform_batch_aos4(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = m * in[i];
+	}
+
+	template <typename T, precision P>
+	struct compute_transform_batch
+	{
+		template <transform_batch_mode Mode>
+		GLM_FUNC_QUALIFIER static void aos3(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			transform_batch_aos3<Mode>(m, in, out, count);
+		}
+
+		template <transform_batch_mode Mode>
+		GLM_FUNC_QUALIFIER static void soa(tmat4x4<T, P> const & m, T const * inX, T const * inY, T const * inZ, T * outX, T * outY, T * outZ, std::size_t count)
+		{
+			transform_batch_soa<Mode>(m, inX, inY, inZ, outX, outY, outZ, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void aos4(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			transform_batch_aos4(m, in, out, count);
+		}
+	};
+
+#if GLM_ARCH & GLM_ARCH_SSE2
+	// The lane traits of detail/_lanes.hpp plus the layouts this extension
+	// moves through them
+
+	struct transform_batch_sse : public lanes_sse
+	{
+		// Four xyz triplets, x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3, to and from component registers
+		GLM_FUNC_QUALIFIER static void load_xyz(float const * p, type & x, type & y, type & z)
+		{
+			__m128 const v0 = _mm_loadu_ps(p);
+			__m128 const v1 = _mm_loadu_ps(p + 4);
+			__m128 const v2 = _mm_loadu_ps(p + 8);
+
+			__m128 const x2y2x3y3 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));
+			__m128 const y0z0y1z1 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 0, 2, 1));
+			x = _mm_shuffle_ps(v0, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+			z = _mm_shuffle_ps(y0z0y1z1, v2, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		GLM_FUNC_QUALIFIER static void store_xyz(float * p, type x, type y, type z)
+		{
+			__m128 const x2y2x3y3 = _mm_unpackhi_ps(x, y);
+			__m128 const y0z0y1z1 = _mm_unpacklo_ps(y, z);
+
+			__m128 const x0x1y0z0 = _mm_shuffle_ps(x, y0z0y1z1, _MM_SHUFFLE(1, 0, 1, 0));
+			_mm_storeu_ps(p, _mm_shuffle_ps(x0x1y0z0, x0x1y0z0, _MM_SHUFFLE(1, 3, 2, 0)));
+
+			_mm_storeu_ps(p + 4, _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			__m128 const z2z3x3y3 = _mm_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(3, 2, 3, 2));
+			_mm_storeu_ps(p + 8, _mm_shuffle_ps(z2z3x3y3, z2z3x3y3, _MM_SHUFFLE(1, 3, 2, 0)));
+		}
+
+		// One tvec4 per register
+		enum { vec4s = 1 };
+
+		GLM_FUNC_QUALIFIER static type load_column(float const * p) { return _mm_loadu_ps(p); }
+
+		template <int Lane>
+		GLM_FUNC_QUALIFIER static type splat(type v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+#if GLM_ARCH & GLM_ARCH_AVX
+	struct transform_batch_avx : public lanes_avx
+	{
+		GLM_FUNC_QUALIFIER static type combine(__m128 lo, __m128 hi)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+		}
+
+		// Eight xyz triplets, as two halves of four
+		GLM_FUNC_QUALIFIER static void load_xyz(float const * p, type & x, type & y, type & z)
+		{
+			__m128 x0, y0, z0, x1, y1, z1;
+			transform_batch_sse::load_xyz(p, x0, y0, z0);
+			transform_batch_sse::load_xyz(p + 12, x1, y1, z1);
+			x = combine(x0, x1);
+			y = combine(y0, y1);
+			z = combine(z0, z1);
+		}
+
+		GLM_FUNC_QUALIFIER static void store_xyz(float * p, type x, type y, type z)
+		{
+			transform_batch_sse::store_xyz(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+			transform_batch_sse::store_xyz(p + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+		}
+
+		// Two tvec4 per register; each matrix column is repeated in both halves
+		enum { vec4s = 2 };
+
+		GLM_FUNC_QUALIFIER static type load_column(float const * p) { return _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(p)); }
+
+		template <int Lane>
+		GLM_FUNC_QUALIFIER static type splat(type v) { return _mm256_permute_ps(v, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+	};
+#endif//GLM_ARCH & GLM_ARCH_AVX
+
+#if GLM_ARCH & GLM_ARCH_SSE2
+	template <typename L, transform_batch_mode Mode>
+	struct transform_batch_kernel
+	{
+		typedef typename L::type type;
+
+		template <precision P>
+		GLM_FUNC_QUALIFIER explicit transform_batch_kernel(tmat4x4<float, P> const & m)
+		{
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				this->m[c][r] = L::set1(m[c][r]);
+		}
+
+		GLM_FUNC_QUALIFIER type row(length_t r, type x, type y, type z) const
+		{
+			type const XY = L::add(L::mul(m[0][r], x), L::mul(m[1][r], y));
+			return Mode == transform_batch_vector ?
+				L::add(XY, L::mul(m[2][r], z)) :
+				L::add(XY, L::add(L::mul(m[2][r], z), m[3][r]));
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(type & x, type & y, type & z) const
+		{
+			type const X = row(0, x, y, z);
+			type const Y = row(1, x, y, z);
+			type const Z = row(2, x, y, z);
+			if(Mode == transform_batch_projective)
+			{
+				type const W = row(3, x, y, z);
+				x = L::div(X, W);
+				y = L::div(Y, W);
+				z = L::div(Z, W);
+			}
+			else
+			{
+				x = X;
+				y = Y;
+				z = Z;
+			}
+		}
+
+		type m[4][4];
+	};
+
+	// Each driver handles whole registers from first on and returns where it stopped
+
+	template <typename L, transform_batch_mode Mode, precision P>
+	GLM_FUNC_QUALIFIER std::size_t transform_batch_aos3_simd(tmat4x4<float, P> const & m, float const * in, float * out, std::size_t first, std::size_t count)
+	{
+		transform_batch_kernel<L, Mode> const Kernel(m);
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			typename L::type x, y, z;
+			L::load_xyz(in + i * 3, x, y, z);
+			Kernel(x, y, z);
+			L::store_xyz(out + i * 3, x, y, z);
+		}
+		return i;
+	}
+
+	template <typename L, transform_batch_mode Mode, precision P>
+	GLM_FUNC_QUALIFIER std::size_t transform_batch_soa_simd(tmat4x4<float, P> const & m, float const * inX, float const * inY, float const * inZ, float * outX, float * outY, float * outZ, std::size_t first, std::size_t count)
+	{
+		transform_batch_kernel<L, Mode> const Kernel(m);
+		std::size_t i = first;
+		for(; count - i >= L::size; i += L::size)
+		{
+			typename L::type x = L::load(inX + i);
+			typename L::type y = L::load(inY + i);
+			typename L::type z = L::load(inZ + i);
+			Kernel(x, y, z);
+			L::store(outX + i, x);
+			L::store(outY + i, y);
+			L::store(outZ + i, z);
+		}
+		return i;
+	}
+
+	// Full m * v, four registers of tvec4 per iteration
+	template <typename L, precision P>
+	GLM_FUNC_QUALIFIER std::size_t transform_batch_aos4_simd(tmat4x4<float, P> const & m, float const * in, float * out, std::size_t first, std::size_t count)
+	{
+		typedef typename L::type type;
+		type const C0 = L::load_column(&m[0][0]);
+		type const C1 = L::load_column(&m[1][0]);
+		type const C2 = L::load_column(&m[2][0]);
+		type const C3 = L::load_column(&m[3][0]);
+
+		std::size_t const Step = L::vec4s * 4;
+		std::size_t i = first;
+		for(; count - i >= Step; i += Step)
+		{
+			for(std::size_t j = 0; j < Step; j += L::vec4s)
+			{
+				type const v = L::load(in + (i + j) * 4);
+				type const XY = L::add(L::mul(C0, L::template splat<0>(v)), L::mul(C1, L::template splat<1>(v)));
+				type const ZW = L::add(L::mul(C2, L::template splat<2>(v)), L::mul(C3, L::template splat<3>(v)));
+				L::store(out + (i + j) * 4, L::add(XY, ZW));
+			}
+		}
+		return i;
+	}
+
+	template <precision P>
+	struct compute_transform_batch<float, P>
+	{
+		template <transform_batch_mode Mode>
+		GLM_FUNC_QUALIFIER static void aos3(tmat4x4<float, P> const & m, tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			float const * In = reinterpret_cast<float const *>(in);
+			float * Out = reinterpret_cast<float *>(out);
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = transform_batch_aos3_simd<transform_batch_avx, Mode>(m, In, Out, i, count);
+#			endif
+			i = transform_batch_aos3_simd<transform_batch_sse, Mode>(m, In, Out, i, count);
+			transform_batch_aos3<Mode>(m, in + i, out + i, count - i);
+		}
+
+		template <transform_batch_mode Mode>
+		GLM_FUNC_QUALIFIER static void soa(tmat4x4<float, P> const & m, float const * inX, float const * inY, float const * inZ, float * outX, float * outY, float * outZ, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = transform_batch_soa_simd<transform_batch_avx, Mode>(m, inX, inY, inZ, outX, outY, outZ, i, count);
+#			endif
+			i = transform_batch_soa_simd<transform_batch_sse, Mode>(m, inX, inY, inZ, outX, outY, outZ, i, count);
+			transform_batch_soa<Mode>(m, inX + i, inY + i, inZ + i, outX + i, outY + i, outZ + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void aos4(tmat4x4<float, P> const & m, tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			float const * In = reinterpret_cast<float const *>(in);
+			float * Out = reinterpret_cast<float *>(out);
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX
+				i = transform_batch_aos4_simd<transform_batch_avx>(m, In, Out, i, count);
+#			endif
+			i = transform_batch_aos4_simd<transform_batch_sse>(m, In, Out, i, count);
+			transform_batch_aos4(m, in + i, out + i, count - i);
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints
+	(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template aos3<detail::transform_batch_point>(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints
+	(
+		tmat4x4<T, P> const & m,
+		tvec4<T, P> const * in,
+		tvec4<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::aos4(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformVectors
+	(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template aos3<detail::transform_batch_vector>(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void projectPoints
+	(
+		tmat4x4<T, P> const & m,
+		tvec3<T, P> const * in,
+		tvec3<T, P> * out,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template aos3<detail::transform_batch_projective>(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPoints
+	(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template soa<detail::transform_batch_point>(m, inX, inY, inZ, outX, outY, outZ, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformVectors
+	(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template soa<detail::transform_batch_vector>(m, inX, inY, inZ, outX, outY, outZ, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void projectPoints
+	(
+		tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count
+	)
+	{
+		detail::compute_transform_batch<T, P>::template soa<detail::transform_batch_projective>(m, inX, inY, inZ, outX, outY, outZ, count);
+	}
+}//namespace glm
@@ -0,0 +1,738 @@
+#include "glrecorder.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+
+/**
+ * The recorder gGl currently routes to, if any
+ */
+static GlRecorder* sActiveRecorder = nullptr;
+
+// argument capture: widen each GL parameter type into a GlCallArg
+
+template<typename T>
+static GlCallArg captureArg(T value, std::true_type /* is pointer */) {
+    GlCallArg arg;
+    arg.kind = GlCallArg::Pointer;
+    arg.p = (const void*) value;
+    return arg;
+}
+
+template<typename T>
+static GlCallArg captureArg(T value, std::false_type /* is pointer */) {
+    GlCallArg arg;
+    if (std::is_floating_point<T>::value) {
+        arg.kind = GlCallArg::Real;
+        arg.f = (double) value;
+    } else {
+        arg.kind = GlCallArg::Integer;
+        arg.i = (int64_t) value;
+    }
+    return arg;
+}
+
+template<typename T>
+static GlCallArg captureArg(T value) {
+    return captureArg(value, std::is_pointer<T>());
+}
+
+template<typename... Args>
+static void recordCall(GlFunction function, Args... values) {
+    if (!sActiveRecorder) {
+        return;
+    }
+    GlCallArg args[sizeof...(Args) + 1] = { captureArg(values)... };
+    sActiveRecorder->record(function, args, (uint8_t) sizeof...(Args));
+}
+
+/**
+ * Lets the generic entry points below apply their parenthesized argument
+ * list directly, e.g. RecordCall{GlFn_Clear} (mask);
+ */
+struct RecordCall {
+    GlFunction function;
+
+    template<typename... Args>
+    void operator()(Args... values) const {
+        recordCall(function, values...);
+    }
+};
+
+/**
+ * Value a recording entry point returns when it has nothing better to say
+ */
+template<typename T>
+static T defaultResult() {
+    return T();
+}
+
+template<>
+void defaultResult<void>() {
+}
+
+// generic recording entry points: count the call, do nothing else
+
+#define GL_RECORDER_ENTRY(ret, name, params, args) \
+    static ret GL_APIENTRY record##name params { \
+        RecordCall{GlFn_##name} args; \
+        return defaultResult<ret>(); \
+    }
+GL_DISPATCH_FUNCTIONS(GL_RECORDER_ENTRY)
+#undef GL_RECORDER_ENTRY
+
+// entry points with behaviour the renderer depends on
+
+static void fakeGenNames(GlFunction function, GLsizei n, GLuint* names) {
+    recordCall(function, n, names);
+    for (GLsizei i = 0; i < n; i++) {
+        names[i] = sActiveRecorder ? sActiveRecorder->newObjectName() : 0;
+    }
+}
+
+static void GL_APIENTRY fakeGenBuffers(GLsizei n, GLuint* buffers) {
+    fakeGenNames(GlFn_GenBuffers, n, buffers);
+}
+
+static void GL_APIENTRY fakeGenVertexArrays(GLsizei n, GLuint* arrays) {
+    fakeGenNames(GlFn_GenVertexArrays, n, arrays);
+}
+
+static GLuint GL_APIENTRY fakeCreateShader(GLenum type) {
+    recordCall(GlFn_CreateShader, type);
+    return sActiveRecorder ? sActiveRecorder->newObjectName() : 0;
+}
+
+static GLuint GL_APIENTRY fakeCreateProgram() {
+    recordCall(GlFn_CreateProgram);
+    if (!sActiveRecorder) {
+        return 0;
+    }
+    GLuint program = sActiveRecorder->newObjectName();
+    sActiveRecorder->attachShader(program, 0);
+    return program;
+}
+
+static void GL_APIENTRY fakeGetShaderiv(GLuint shader, GLenum pname, GLint* params) {
+    recordCall(GlFn_GetShaderiv, shader, pname, params);
+    *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+static void GL_APIENTRY fakeShaderSource(GLuint shader, GLsizei count, const GLchar* const* string,
+                                         const GLint* length) {
+    recordCall(GlFn_ShaderSource, shader, count, string, length);
+    if (sActiveRecorder) {
+        sActiveRecorder->setShaderSource(shader, count, string, length);
+    }
+}
+
+static void GL_APIENTRY fakeAttachShader(GLuint program, GLuint shader) {
+    recordCall(GlFn_AttachShader, program, shader);
+    if (sActiveRecorder) {
+        sActiveRecorder->attachShader(program, shader);
+    }
+}
+
+static void GL_APIENTRY fakeDetachShader(GLuint program, GLuint shader) {
+    recordCall(GlFn_DetachShader, program, shader);
+    if (sActiveRecorder) {
+        sActiveRecorder->detachShader(program, shader);
+    }
+}
+
+static void GL_APIENTRY fakeLinkProgram(GLuint program) {
+    recordCall(GlFn_LinkProgram, program);
+    if (sActiveRecorder) {
+        sActiveRecorder->linkProgram(program);
+    }
+}
+
+static void GL_APIENTRY fakeGetProgramiv(GLuint program, GLenum pname, GLint* params) {
+    recordCall(GlFn_GetProgramiv, program, pname, params);
+    const GlRecorder::FakeProgram* fake = sActiveRecorder ? sActiveRecorder->program(program) : nullptr;
+    *params = 0;
+    switch (pname) {
+        case GL_LINK_STATUS:
+            *params = (!fake || fake->linked) ? GL_TRUE : GL_FALSE;
+            break;
+        case GL_PROGRAM_BINARY_LENGTH:
+            *params = sActiveRecorder ? (GLint) sActiveRecorder->programBinary(program).size() : 0;
+            break;
+        case GL_ACTIVE_UNIFORMS:
+            *params = fake ? (GLint) fake->uniforms.size() : 0;
+            break;
+        case GL_ACTIVE_ATTRIBUTES:
+            *params = fake ? (GLint) fake->attributes.size() : 0;
+            break;
+        case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+        case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:
+            if (fake) {
+                const auto& variables = pname == GL_ACTIVE_UNIFORM_MAX_LENGTH ? fake->uniforms : fake->attributes;
+                for (const auto& variable : variables) {
+                    // room for a "[0]" suffix and the terminator
+                    *params = std::max(*params, (GLint) variable.name.size() + 4);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void GL_APIENTRY fakeGetIntegerv(GLenum pname, GLint* data) {
+    recordCall(GlFn_GetIntegerv, pname, data);
+    switch (pname) {
+        case GL_NUM_PROGRAM_BINARY_FORMATS:
+            *data = 1;
+            break;
+        case GL_PROGRAM_BINARY_FORMATS:
+            *data = (GLint) GlRecorder::kProgramBinaryFormat;
+            break;
+        case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+            // the largest alignment drivers commonly ask for
+            *data = 256;
+            break;
+        default:
+            *data = 0;
+            break;
+    }
+}
+
+static void GL_APIENTRY fakeGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length,
+                                             GLenum* binaryFormat, void* binary) {
+    recordCall(GlFn_GetProgramBinary, program, bufSize, length, binaryFormat, binary);
+    std::string fake = sActiveRecorder ? sActiveRecorder->programBinary(program) : std::string();
+    GLsizei copied = std::min((GLsizei) fake.size(), bufSize);
+    memcpy(binary, fake.data(), (size_t) copied);
+    if (length) {
+        *length = copied;
+    }
+    *binaryFormat = GlRecorder::kProgramBinaryFormat;
+}
+
+static void GL_APIENTRY fakeProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length) {
+    recordCall(GlFn_ProgramBinary, program, binaryFormat, binary, length);
+    if (sActiveRecorder) {
+        sActiveRecorder->loadProgramBinary(program, binaryFormat, binary, length);
+    }
+}
+
+static void fakeGetActive(const std::vector<GlRecorder::FakeVariable>* variables, GLuint index,
+                          GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name) {
+    if (!variables || index >= variables->size() || bufSize <= 0) {
+        if (length) {
+            *length = 0;
+        }
+        return;
+    }
+    const GlRecorder::FakeVariable& variable = (*variables)[index];
+    std::string reported = variable.size > 1 ? variable.name + "[0]" : variable.name;
+    GLsizei copied = std::min((GLsizei) reported.size(), bufSize - 1);
+    memcpy(name, reported.data(), (size_t) copied);
+    name[copied] = '\0';
+    if (length) {
+        *length = copied;
+    }
+    *size = variable.size;
+    *type = variable.type;
+}
+
+static void GL_APIENTRY fakeGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length,
+                                             GLint* size, GLenum* type, GLchar* name) {
+    recordCall(GlFn_GetActiveUniform, program, index, bufSize, length, size, type, name);
+    const GlRecorder::FakeProgram* fake = sActiveRecorder ? sActiveRecorder->program(program) : nullptr;
+    fakeGetActive(fake ? &fake->uniforms : nullptr, index, bufSize, length, size, type, name);
+}
+
+static void GL_APIENTRY fakeGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length,
+                                            GLint* size, GLenum* type, GLchar* name) {
+    recordCall(GlFn_GetActiveAttrib, program, index, bufSize, length, size, type, name);
+    const GlRecorder::FakeProgram* fake = sActiveRecorder ? sActiveRecorder->program(program) : nullptr;
+    fakeGetActive(fake ? &fake->attributes : nullptr, index, bufSize, length, size, type, name);
+}
+
+static GLint GL_APIENTRY fakeGetUniformLocation(GLuint program, const GLchar* name) {
+    recordCall(GlFn_GetUniformLocation, program, name);
+    return sActiveRecorder ? sActiveRecorder->fakeLocation(program, name, false) : -1;
+}
+
+static GLint GL_APIENTRY fakeGetAttribLocation(GLuint program, const GLchar* name) {
+    recordCall(GlFn_GetAttribLocation, program, name);
+    return sActiveRecorder ? sActiveRecorder->fakeLocation(program, name, true) : -1;
+}
+
+static const GLubyte* GL_APIENTRY fakeGetString(GLenum name) {
+    recordCall(GlFn_GetString, name);
+    switch (name) {
+        case GL_VENDOR:
+            return (const GLubyte*) "jnidemo";
+        case GL_RENDERER:
+            return (const GLubyte*) "GlRecorder (headless)";
+        case GL_VERSION:
+            return (const GLubyte*) "OpenGL ES 3.2 GlRecorder";
+        case GL_SHADING_LANGUAGE_VERSION:
+            return (const GLubyte*) "OpenGL ES GLSL ES 3.20";
+        default:
+            return (const GLubyte*) "";
+    }
+}
+
+static GLuint GL_APIENTRY fakeGetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName) {
+    recordCall(GlFn_GetUniformBlockIndex, program, uniformBlockName);
+    return sActiveRecorder ? sActiveRecorder->fakeUniformBlockIndex(program, uniformBlockName) : GL_INVALID_INDEX;
+}
+
+static void GL_APIENTRY fakeBindBuffer(GLenum target, GLuint buffer) {
+    recordCall(GlFn_BindBuffer, target, buffer);
+    if (sActiveRecorder) {
+        sActiveRecorder->bindBuffer(target, buffer);
+    }
+}
+
+static void GL_APIENTRY fakeBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
+                                            GLsizeiptr size) {
+    recordCall(GlFn_BindBufferRange, target, index, buffer, offset, size);
+    // like glBindBufferRange, this also binds the buffer to the generic target
+    if (sActiveRecorder) {
+        sActiveRecorder->bindBuffer(target, buffer);
+    }
+}
+
+static void GL_APIENTRY fakeBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+    recordCall(GlFn_BufferData, target, size, data, usage);
+    if (sActiveRecorder) {
+        sActiveRecorder->bufferData(target, size, data);
+    }
+}
+
+static void GL_APIENTRY fakeBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    recordCall(GlFn_BufferSubData, target, offset, size, data);
+    if (sActiveRecorder) {
+        sActiveRecorder->bufferSubData(target, offset, size, data);
+    }
+}
+
+static void* GL_APIENTRY fakeMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    recordCall(GlFn_MapBufferRange, target, offset, length, access);
+    return sActiveRecorder ? sActiveRecorder->mapBufferRange(target, offset, length) : nullptr;
+}
+
+static GLboolean GL_APIENTRY fakeUnmapBuffer(GLenum target) {
+    recordCall(GlFn_UnmapBuffer, target);
+    return GL_TRUE;
+}
+
+/**
+ * Stands in for every fence object; nothing ever waits on it
+ */
+static int sFakeSync;
+
+static GLsync GL_APIENTRY fakeFenceSync(GLenum condition, GLbitfield flags) {
+    recordCall(GlFn_FenceSync, condition, flags);
+    return (GLsync) &sFakeSync;
+}
+
+static GLenum GL_APIENTRY fakeClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    recordCall(GlFn_ClientWaitSync, sync, flags, timeout);
+    return GL_ALREADY_SIGNALED;
+}
+
+GlRecorder::GlRecorder() :
+        mCaptureArguments(false),
+        mFrameIndex(0),
+        mLastObjectName(0) {
+    memset(&mCurrentFrame, 0, sizeof(mCurrentFrame));
+    memset(&mLastFrame, 0, sizeof(mLastFrame));
+    memset(mLifetimeCounts, 0, sizeof(mLifetimeCounts));
+    mFrameStart = std::chrono::steady_clock::now();
+}
+
+GlRecorder::~GlRecorder() {
+    if (sActiveRecorder == this) {
+        sActiveRecorder = nullptr;
+        if (!installNativeGlDispatch()) {
+            installGlDispatch(GlDispatch());
+        }
+    }
+}
+
+void GlRecorder::install() {
+    GlDispatch table = {
+#define GL_RECORDER_TABLE(ret, name, params, args) record##name,
+            GL_DISPATCH_FUNCTIONS(GL_RECORDER_TABLE)
+#undef GL_RECORDER_TABLE
+    };
+    table.GenBuffers = fakeGenBuffers;
+    table.GenVertexArrays = fakeGenVertexArrays;
+    table.CreateShader = fakeCreateShader;
+    table.CreateProgram = fakeCreateProgram;
+    table.ShaderSource = fakeShaderSource;
+    table.AttachShader = fakeAttachShader;
+    table.DetachShader = fakeDetachShader;
+    table.LinkProgram = fakeLinkProgram;
+    table.GetShaderiv = fakeGetShaderiv;
+    table.GetProgramiv = fakeGetProgramiv;
+    table.GetActiveUniform = fakeGetActiveUniform;
+    table.GetActiveAttrib = fakeGetActiveAttrib;
+    table.GetIntegerv = fakeGetIntegerv;
+    table.GetProgramBinary = fakeGetProgramBinary;
+    table.ProgramBinary = fakeProgramBinary;
+    table.GetUniformLocation = fakeGetUniformLocation;
+    table.GetAttribLocation = fakeGetAttribLocation;
+    table.GetString = fakeGetString;
+    table.GetUniformBlockIndex = fakeGetUniformBlockIndex;
+    table.BindBuffer = fakeBindBuffer;
+    table.BindBufferRange = fakeBindBufferRange;
+    table.BufferData = fakeBufferData;
+    table.BufferSubData = fakeBufferSubData;
+    table.MapBufferRange = fakeMapBufferRange;
+    table.UnmapBuffer = fakeUnmapBuffer;
+    table.FenceSync = fakeFenceSync;
+    table.ClientWaitSync = fakeClientWaitSync;
+
+    sActiveRecorder = this;
+    installGlDispatch(table);
+}
+
+GlRecorder* GlRecorder::active() {
+    return sActiveRecorder;
+}
+
+void GlRecorder::setCaptureArguments(bool capture) {
+    mCaptureArguments = capture;
+    if (!capture) {
+        mCalls.clear();
+    }
+}
+
+void GlRecorder::beginFrame() {
+    memset(&mCurrentFrame, 0, sizeof(mCurrentFrame));
+    mCurrentFrame.frameIndex = mFrameIndex;
+    mCalls.clear();
+    mFrameStart = std::chrono::steady_clock::now();
+}
+
+const GlFrameStats& GlRecorder::endFrame() {
+    auto frameEnd = std::chrono::steady_clock::now();
+    mCurrentFrame.cpuMillis = std::chrono::duration<double, std::milli>(frameEnd - mFrameStart).count();
+    mLastFrame = mCurrentFrame;
+    mFrameIndex++;
+    return mLastFrame;
+}
+
+void GlRecorder::record(GlFunction function, const GlCallArg* args, uint8_t argCount) {
+    mCurrentFrame.callCounts[function]++;
+    mCurrentFrame.totalCalls++;
+    mLifetimeCounts[function]++;
+    if (mCaptureArguments) {
+        GlCall call;
+        call.function = function;
+        call.argCount = argCount;
+        memcpy(call.args, args, argCount * sizeof(GlCallArg));
+        mCalls.push_back(call);
+    }
+}
+
+void GlRecorder::setShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings,
+                                 const GLint* lengths) {
+    std::string source;
+    for (GLsizei i = 0; i < count; i++) {
+        if (lengths && lengths[i] >= 0) {
+            source.append(strings[i], (size_t) lengths[i]);
+        } else {
+            source.append(strings[i]);
+        }
+    }
+    mShaderSources[shader] = source;
+}
+
+void GlRecorder::attachShader(GLuint program, GLuint shader) {
+    FakeProgram& fake = mPrograms[program];
+    if (shader) {
+        fake.shaders.push_back(shader);
+    }
+}
+
+void GlRecorder::detachShader(GLuint program, GLuint shader) {
+    FakeProgram& fake = mPrograms[program];
+    fake.shaders.erase(std::remove(fake.shaders.begin(), fake.shaders.end(), shader), fake.shaders.end());
+}
+
+/**
+ * @param glslType a GLSL type name, e.g. "vec3"
+ * @return the matching GL type enum, or GL_NONE if we don't know it
+ */
+static GLenum glslTypeEnum(const std::string& glslType) {
+    static const struct {
+        const char* name;
+        GLenum type;
+    } kTypes[] = {
+            {"float", GL_FLOAT}, {"vec2", GL_FLOAT_VEC2}, {"vec3", GL_FLOAT_VEC3}, {"vec4", GL_FLOAT_VEC4},
+            {"int", GL_INT}, {"ivec2", GL_INT_VEC2}, {"ivec3", GL_INT_VEC3}, {"ivec4", GL_INT_VEC4},
+            {"uint", GL_UNSIGNED_INT}, {"bool", GL_BOOL},
+            {"mat2", GL_FLOAT_MAT2}, {"mat3", GL_FLOAT_MAT3}, {"mat4", GL_FLOAT_MAT4},
+            {"sampler2D", GL_SAMPLER_2D}, {"sampler3D", GL_SAMPLER_3D}, {"samplerCube", GL_SAMPLER_CUBE},
+            {"sampler2DShadow", GL_SAMPLER_2D_SHADOW}, {"sampler2DArray", GL_SAMPLER_2D_ARRAY},
+    };
+    for (const auto& entry : kTypes) {
+        if (glslType == entry.name) {
+            return entry.type;
+        }
+    }
+    return GL_NONE;
+}
+
+/**
+ * Pulls "uniform T name;" and (for vertex shaders) "in T name;" declarations
+ * out of GLSL source.  This is nowhere near a GLSL parser; it only has to
+ * understand the shaders this app ships.
+ */
+static void scrapeDeclarations(const std::string& source,
+                               std::vector<GlRecorder::FakeVariable>& uniforms,
+                               std::vector<GlRecorder::FakeVariable>* attributes) {
+    static const char* const kQualifiers[] = {
+            "lowp", "mediump", "highp", "flat", "smooth", "centroid", "invariant"
+    };
+    // preprocessor lines (#version, #define...) are not statements
+    std::string code;
+    std::istringstream lines(source);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.find_first_not_of(" \t") != std::string::npos && line[line.find_first_not_of(" \t")] == '#') {
+            continue;
+        }
+        code += line;
+        code += '\n';
+    }
+
+    size_t start = 0;
+    while (start < code.size()) {
+        size_t end = code.find(';', start);
+        if (end == std::string::npos) {
+            end = code.size();
+        }
+        std::string statement = code.substr(start, end - start);
+        start = end + 1;
+
+        // only the part after the last brace can be a declaration
+        size_t brace = statement.find_last_of("{}");
+        if (brace != std::string::npos) {
+            statement = statement.substr(brace + 1);
+        }
+        // drop any layout(...) qualifier
+        size_t layout = statement.find("layout");
+        if (layout != std::string::npos) {
+            size_t close = statement.find(')', layout);
+            if (close != std::string::npos) {
+                statement.erase(layout, close - layout + 1);
+            }
+        }
+
+        std::istringstream tokens(statement);
+        std::vector<std::string> words;
+        std::string word;
+        while (tokens >> word) {
+            bool qualifier = false;
+            for (const char* skip : kQualifiers) {
+                qualifier |= word == skip;
+            }
+            if (!qualifier) {
+                words.push_back(word);
+            }
+        }
+        if (words.size() != 3) {
+            continue;
+        }
+        std::vector<GlRecorder::FakeVariable>* target = nullptr;
+        if (words[0] == "uniform") {
+            target = &uniforms;
+        } else if (words[0] == "in") {
+            target = attributes;
+        }
+        GLenum type = glslTypeEnum(words[1]);
+        if (!target || type == GL_NONE) {
+            continue;
+        }
+
+        GlRecorder::FakeVariable variable;
+        variable.name = words[2];
+        variable.type = type;
+        variable.size = 1;
+        size_t bracket = variable.name.find('[');
+        if (bracket != std::string::npos) {
+            variable.size = std::max(1, atoi(variable.name.c_str() + bracket + 1));
+            variable.name.resize(bracket);
+        }
+        bool duplicate = false;
+        for (const auto& existing : *target) {
+            duplicate |= existing.name == variable.name;
+        }
+        if (!duplicate) {
+            variable.location = target->empty() ? 0 : target->back().location + target->back().size;
+            target->push_back(variable);
+        }
+    }
+}
+
+/**
+ * Rebuilds the active variable lists of fake from its linkedSources
+ */
+static void reflectSources(GlRecorder::FakeProgram& fake) {
+    fake.uniforms.clear();
+    fake.attributes.clear();
+    for (const std::string& source : fake.linkedSources) {
+        // a vertex shader is the one that writes gl_Position
+        bool vertexShader = source.find("gl_Position") != std::string::npos;
+        scrapeDeclarations(source, fake.uniforms, vertexShader ? &fake.attributes : nullptr);
+    }
+}
+
+void GlRecorder::linkProgram(GLuint program) {
+    FakeProgram& fake = mPrograms[program];
+    fake.linkedSources.clear();
+    for (GLuint shader : fake.shaders) {
+        fake.linkedSources.push_back(mShaderSources[shader]);
+    }
+    reflectSources(fake);
+    fake.linked = true;
+}
+
+/**
+ * Separates the shader sources inside a fake program binary
+ */
+static const char kBinarySourceSeparator = '\0';
+
+std::string GlRecorder::programBinary(GLuint program) const {
+    const FakeProgram* fake = this->program(program);
+    std::string binary;
+    if (!fake || !fake->linked) {
+        return binary;
+    }
+    for (const std::string& source : fake->linkedSources) {
+        binary += source;
+        binary += kBinarySourceSeparator;
+    }
+    return binary;
+}
+
+void GlRecorder::loadProgramBinary(GLuint program, GLenum format, const void* binary, GLsizei length) {
+    FakeProgram& fake = mPrograms[program];
+    fake.linkedSources.clear();
+    fake.linked = false;
+    if (format != kProgramBinaryFormat || length <= 0) {
+        reflectSources(fake);
+        return;
+    }
+    std::string blob((const char*) binary, (size_t) length);
+    if (blob.back() != kBinarySourceSeparator) {
+        reflectSources(fake);
+        return;
+    }
+    size_t start = 0;
+    while (start < blob.size()) {
+        size_t end = blob.find(kBinarySourceSeparator, start);
+        fake.linkedSources.push_back(blob.substr(start, end - start));
+        start = end + 1;
+    }
+    reflectSources(fake);
+    fake.linked = true;
+}
+
+const GlRecorder::FakeProgram* GlRecorder::program(GLuint program) const {
+    auto found = mPrograms.find(program);
+    return found != mPrograms.end() ? &found->second : nullptr;
+}
+
+GLint GlRecorder::fakeLocation(GLuint program, const char* name, bool attribute) const {
+    const FakeProgram* fake = this->program(program);
+    if (!fake) {
+        return -1;
+    }
+    std::string wanted(name);
+    int element = 0;
+    size_t bracket = wanted.find('[');
+    if (bracket != std::string::npos) {
+        element = atoi(wanted.c_str() + bracket + 1);
+        wanted.resize(bracket);
+    }
+    for (const FakeVariable& variable : attribute ? fake->attributes : fake->uniforms) {
+        if (variable.name == wanted && element < variable.size) {
+            return variable.location + element;
+        }
+    }
+    return -1;
+}
+
+GLuint GlRecorder::fakeUniformBlockIndex(GLuint program, const char* name) const {
+    const FakeProgram* fake = this->program(program);
+    if (!fake || !fake->linked) {
+        return GL_INVALID_INDEX;
+    }
+    // blocks are numbered in order of first appearance across the linked sources
+    std::vector<std::string> blocks;
+    for (const std::string& source : fake->linkedSources) {
+        std::istringstream stream(source);
+        std::vector<std::string> words{std::istream_iterator<std::string>(stream),
+                                       std::istream_iterator<std::string>()};
+        for (size_t i = 0; i + 1 < words.size(); i++) {
+            if (words[i] != "uniform") {
+                continue;
+            }
+            // "uniform Name {" or "uniform Name{"; plain uniforms have a type and a name instead
+            const std::string& word = words[i + 1];
+            bool opensBlock = word.find('{') != std::string::npos
+                              || (i + 2 < words.size() && words[i + 2][0] == '{');
+            std::string blockName = word.substr(0, word.find('{'));
+            if (opensBlock && std::find(blocks.begin(), blocks.end(), blockName) == blocks.end()) {
+                blocks.push_back(blockName);
+            }
+        }
+    }
+    auto found = std::find(blocks.begin(), blocks.end(), std::string(name));
+    return found != blocks.end() ? (GLuint) (found - blocks.begin()) : GL_INVALID_INDEX;
+}
+
+void GlRecorder::bindBuffer(GLenum target, GLuint buffer) {
+    mBoundBuffers[target] = buffer;
+}
+
+std::vector<uint8_t>* GlRecorder::boundStorage(GLenum target) {
+    auto bound = mBoundBuffers.find(target);
+    if (bound == mBoundBuffers.end() || bound->second == 0) {
+        return nullptr;
+    }
+    return &mBuffers[bound->second];
+}
+
+void GlRecorder::bufferData(GLenum target, GLsizeiptr size, const void* data) {
+    std::vector<uint8_t>* storage = boundStorage(target);
+    if (!storage || size < 0) {
+        return;
+    }
+    storage->assign((size_t) size, 0);
+    if (data) {
+        memcpy(storage->data(), data, (size_t) size);
+    }
+}
+
+void GlRecorder::bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    void* destination = mapBufferRange(target, offset, size);
+    if (destination && data) {
+        memcpy(destination, data, (size_t) size);
+    }
+}
+
+void* GlRecorder::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    std::vector<uint8_t>* storage = boundStorage(target);
+    if (!storage || offset < 0 || length < 0 || (size_t) (offset + length) > storage->size()) {
+        return nullptr;
+    }
+    return storage->data() + offset;
+}
+
+const std::vector<uint8_t>* GlRecorder::bufferContents(GLuint buffer) const {
+    auto found = mBuffers.find(buffer);
+    return found != mBuffers.end() ? &found->second : nullptr;
+}
@@ -0,0 +1,222 @@
+#ifndef JNIDEMO_GLRECORDER_H
+#define JNIDEMO_GLRECORDER_H
+
+#include "gldispatch.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Most arguments any entry point in GL_DISPATCH_FUNCTIONS takes
+ */
+#define GL_RECORDER_MAX_ARGS 10
+
+/**
+ * One captured GL call argument.  Enums, names and sizes are widened to
+ * integer, floats to real, and buffers/strings are kept as raw pointers
+ * (only valid for as long as the caller kept them alive).
+ */
+struct GlCallArg {
+    enum Kind : uint8_t { Integer, Real, Pointer };
+    Kind kind;
+    union {
+        int64_t i;
+        double f;
+        const void* p;
+    };
+};
+
+/**
+ * A single recorded GL call
+ */
+struct GlCall {
+    GlFunction function;
+    uint8_t argCount;
+    GlCallArg args[GL_RECORDER_MAX_ARGS];
+};
+
+/**
+ * What one frame (beginFrame() to endFrame()) cost on the GL side
+ */
+struct GlFrameStats {
+    uint64_t frameIndex;
+    uint32_t totalCalls;
+    uint32_t callCounts[GlFn_Count];
+    /**
+     * wall time between beginFrame() and endFrame() spent on the calling thread
+     */
+    double cpuMillis;
+};
+
+/**
+ * Headless GL backend.  Once installed, every GL call made through gGl is
+ * counted (and optionally captured with its arguments) instead of reaching
+ * a driver, so the render path can be measured on a plain Linux host.
+ *
+ * Just enough GL behaviour is faked for the renderer to run: object names
+ * are handed out sequentially, shaders always compile, programs always link,
+ * and the active uniforms and attributes of a program are scraped from the
+ * declarations in its shader sources so reflection works as on a driver.
+ */
+class GlRecorder {
+public:
+    /**
+     * A uniform or attribute declaration found in a fake program's sources
+     */
+    struct FakeVariable {
+        std::string name;
+        GLenum type;
+        GLint size;
+        GLint location;
+    };
+
+    /**
+     * What the recorder knows about a program object
+     */
+    struct FakeProgram {
+        std::vector<GLuint> shaders;
+        /**
+         * sources the program was last linked from; also what its fake
+         * program binary consists of
+         */
+        std::vector<std::string> linkedSources;
+        std::vector<FakeVariable> uniforms;
+        std::vector<FakeVariable> attributes;
+        bool linked = false;
+    };
+
+    /**
+     * The only program binary format the recorder reports and accepts
+     */
+    static const GLenum kProgramBinaryFormat = 0x6a64;
+
+    GlRecorder();
+    ~GlRecorder();
+
+    GlRecorder(const GlRecorder&) = delete;
+    GlRecorder& operator=(const GlRecorder&) = delete;
+
+    /**
+     * Routes gGl to this recorder.  Only one recorder can be active at a time.
+     */
+    void install();
+
+    /**
+     * @return the installed recorder, or nullptr if gGl is not being recorded
+     */
+    static GlRecorder* active();
+
+    /**
+     * @param capture true to keep every call and its arguments for the current
+     *                frame (see frameCalls()), false to only count calls
+     */
+    void setCaptureArguments(bool capture);
+
+    /**
+     * Starts a new frame, resetting the per-frame counters and captured calls
+     */
+    void beginFrame();
+
+    /**
+     * Closes the current frame
+     * @return the stats of the frame just closed, also available from lastFrame()
+     */
+    const GlFrameStats& endFrame();
+
+    const GlFrameStats& lastFrame() const { return mLastFrame; }
+
+    /**
+     * @return calls captured since beginFrame(); empty unless capture is enabled
+     */
+    const std::vector<GlCall>& frameCalls() const { return mCalls; }
+
+    /**
+     * @return number of calls to function since the recorder was created
+     */
+    uint64_t lifetimeCalls(GlFunction function) const { return mLifetimeCounts[function]; }
+
+    /**
+     * Called by the recording entry points for every GL call
+     */
+    void record(GlFunction function, const GlCallArg* args, uint8_t argCount);
+
+    /**
+     * @return a fresh, non-zero object name
+     */
+    GLuint newObjectName() { return ++mLastObjectName; }
+
+    void setShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths);
+    void attachShader(GLuint program, GLuint shader);
+    void detachShader(GLuint program, GLuint shader);
+
+    /**
+     * Rebuilds the program's active uniform and attribute lists from the
+     * sources of its attached shaders
+     */
+    void linkProgram(GLuint program);
+
+    /**
+     * @return the fake binary of a linked program, as glGetProgramBinary returns it
+     */
+    std::string programBinary(GLuint program) const;
+
+    /**
+     * Relinks program from a binary produced by programBinary(); an unknown
+     * format or malformed binary leaves the program unlinked, as on a driver
+     */
+    void loadProgramBinary(GLuint program, GLenum format, const void* binary, GLsizei length);
+
+    /**
+     * @return the fake program state, or nullptr if program was never created
+     */
+    const FakeProgram* program(GLuint program) const;
+
+    /**
+     * @return the location of the named uniform or attribute of program, or -1
+     */
+    GLint fakeLocation(GLuint program, const char* name, bool attribute) const;
+
+    /**
+     * @return index of the named uniform block of program, or GL_INVALID_INDEX
+     */
+    GLuint fakeUniformBlockIndex(GLuint program, const char* name) const;
+
+    void bindBuffer(GLenum target, GLuint buffer);
+
+    /**
+     * (Re)allocates the storage of the buffer bound to target, copying data if given
+     */
+    void bufferData(GLenum target, GLsizeiptr size, const void* data);
+    void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+
+    /**
+     * @return a pointer into the storage of the buffer bound to target, or
+     *         nullptr if the range is outside it
+     */
+    void* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length);
+
+    /**
+     * @return the contents of a buffer, or nullptr if it never had storage allocated
+     */
+    const std::vector<uint8_t>* bufferContents(GLuint buffer) const;
+
+private:
+    std::vector<uint8_t>* boundStorage(GLenum target);
+
+    bool mCaptureArguments;
+    uint64_t mFrameIndex;
+    GlFrameStats mCurrentFrame;
+    GlFrameStats mLastFrame;
+    std::chrono::steady_clock::time_point mFrameStart;
+    std::vector<GlCall> mCalls;
+    uint64_t mLifetimeCounts[GlFn_Count];
+    GLuint mLastObjectName;
+    std::map<GLuint, std::string> mShaderSources;
+    std::map<GLuint, FakeProgram> mPrograms;
+    std::map<GLenum, GLuint> mBoundBuffers;
+    std::map<GLuint, std::vector<uint8_t>> mBuffers;
+};
+
+#endif //JNIDEMO_GLRECORDER_H
@@ -0,0 +1,140 @@
+#include "instancedbatch.h"
+#include <android/log.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#define  LOG_TAG    "instancedbatch"
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+/**
+ * @return the [0, 1] channel value scaled into a byte
+ */
+static inline uint32_t toUnorm8(float channel) {
+    return (uint32_t) (channel * 255.0f + 0.5f);
+}
+
+InstancedBatch::InstancedBatch() :
+        mVaoID(0),
+        mMeshVertexCount(0),
+        mTransformAttrib(-1),
+        mColorAttrib(-1) {
+}
+
+bool InstancedBatch::init(const ShaderProgram& program, GLuint meshBuffer, GLsizei meshVertexCount) {
+    GLint positionAttrib = program.attribLocation("position");
+    GLint transformAttrib = program.attribLocation("i_transform");
+    GLint colorAttrib = program.attribLocation("i_color");
+    if (positionAttrib < 0 || transformAttrib < 0 || colorAttrib < 0) {
+        LOGE("instancing program is missing attributes (position %d, i_transform %d, i_color %d)",
+             positionAttrib, transformAttrib, colorAttrib);
+        return false;
+    }
+    mMeshVertexCount = meshVertexCount;
+    mTransformAttrib = transformAttrib;
+    mColorAttrib = colorAttrib;
+
+    gGl.GenVertexArrays(1, &mVaoID);
+    gGl.BindVertexArray(mVaoID);
+
+    // per-vertex mesh positions, shared with the single-triangle path
+    gGl.BindBuffer(GL_ARRAY_BUFFER, meshBuffer);
+    gGl.VertexAttribPointer((GLuint) positionAttrib, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    gGl.EnableVertexAttribArray((GLuint) positionAttrib);
+
+    // per-instance data, advanced once per instance rather than per vertex.
+    // Where it lives changes every frame, so draw() points the attributes at it.
+    gGl.EnableVertexAttribArray((GLuint) transformAttrib);
+    gGl.VertexAttribDivisor((GLuint) transformAttrib, 1);
+    gGl.EnableVertexAttribArray((GLuint) colorAttrib);
+    gGl.VertexAttribDivisor((GLuint) colorAttrib, 1);
+
+    gGl.BindVertexArray(0);
+    return true;
+}
+
+void InstancedBatch::destroy() {
+    if (mVaoID) {
+        gGl.DeleteVertexArrays(1, &mVaoID);
+    }
+    reset();
+}
+
+void InstancedBatch::reset() {
+    mVaoID = 0;
+    mTransformAttrib = -1;
+    mColorAttrib = -1;
+}
+
+void InstancedBatch::setInstanceCount(size_t count, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> position(-0.95f, 0.95f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> spin(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 1.0f);
+
+    // shrink instances as the batch grows so the screen stays readable
+    float baseScale = 0.5f / std::sqrt((float) std::max<size_t>(count, 1));
+
+    mPositionX.resize(count);
+    mPositionY.resize(count);
+    mBaseAngle.resize(count);
+    mSpin.resize(count);
+    mScale.resize(count);
+    mColorPhase.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        mPositionX[i] = position(generator);
+        mPositionY[i] = position(generator);
+        mBaseAngle[i] = angle(generator);
+        mSpin[i] = spin(generator);
+        mScale[i] = baseScale * scale(generator);
+        mColorPhase[i] = angle(generator);
+    }
+    mPacked.resize(count);
+}
+
+void InstancedBatch::update(float elapsedTime) {
+    const size_t count = mPositionX.size();
+    const float* positionX = mPositionX.data();
+    const float* positionY = mPositionY.data();
+    const float* baseAngle = mBaseAngle.data();
+    const float* spin = mSpin.data();
+    const float* scale = mScale.data();
+    const float* colorPhase = mColorPhase.data();
+    InstanceVertex* packed = mPacked.data();
+    for (size_t i = 0; i < count; i++) {
+        float angle = baseAngle[i] + spin[i] * elapsedTime;
+        float phase = colorPhase[i] + elapsedTime;
+        packed[i].transform[0] = std::cos(angle) * scale[i];
+        packed[i].transform[1] = std::sin(angle) * scale[i];
+        packed[i].transform[2] = positionX[i];
+        packed[i].transform[3] = positionY[i];
+        // same palette as the single triangle, shifted per instance
+        uint32_t red = toUnorm8((std::sin(phase) + 1.0f) / 2.0f);
+        uint32_t green = toUnorm8(0.3f);
+        uint32_t blue = toUnorm8((std::cos(phase) + 1.0f) / 2.0f);
+        packed[i].color = red | (green << 8) | (blue << 16) | (0xffu << 24);
+    }
+}
+
+void InstancedBatch::draw(StreamingVertexBuffer& stream) {
+    const size_t count = mPacked.size();
+    if (!mVaoID || count == 0) {
+        return;
+    }
+    const GLsizeiptr bytes = (GLsizeiptr) (count * sizeof(InstanceVertex));
+    const GLintptr offset = stream.write(mPacked.data(), bytes, sizeof(InstanceVertex));
+    if (offset < 0) {
+        LOGE("could not stream %zu instances", count);
+        return;
+    }
+    gGl.BindVertexArray(mVaoID);
+    // stream.write() left the ring bound to GL_ARRAY_BUFFER
+    gGl.VertexAttribPointer((GLuint) mTransformAttrib, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceVertex),
+                            (const void*) (offset + offsetof(InstanceVertex, transform)));
+    gGl.VertexAttribPointer((GLuint) mColorAttrib, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(InstanceVertex),
+                            (const void*) (offset + offsetof(InstanceVertex, color)));
+    gGl.DrawArraysInstanced(GL_TRIANGLES, 0, mMeshVertexCount, (GLsizei) count);
+    gGl.BindVertexArray(0);
+}
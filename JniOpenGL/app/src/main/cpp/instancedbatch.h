@@ -0,0 +1,105 @@
+#ifndef JNIDEMO_INSTANCEDBATCH_H
+#define JNIDEMO_INSTANCEDBATCH_H
+
+#include "gldispatch.h"
+#include "shaderprogram.h"
+#include "streamingbuffer.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Draws N copies of a mesh, each independently rotating and colored, with a
+ * single glDrawArraysInstanced call.
+ *
+ * Instance state lives on the CPU as structure-of-arrays so the per-frame
+ * animation loop streams through tightly packed floats.  Each frame it is
+ * packed into one interleaved InstanceVertex per instance and streamed into
+ * a StreamingVertexBuffer, which the VAO feeds to the shader with a divisor of 1.
+ */
+class InstancedBatch {
+public:
+    /**
+     * Per-instance vertex data as the GPU sees it, 20 bytes per instance
+     */
+    struct InstanceVertex {
+        /**
+         * rotation and scale folded into (cos * scale, sin * scale),
+         * followed by the translation (x, y)
+         */
+        float transform[4];
+        /**
+         * RGBA8, normalized by the vertex fetch
+         */
+        uint32_t color;
+    };
+
+    InstancedBatch();
+
+    /**
+     * Creates the VAO.  Must be called on the GL thread.
+     * @param program linked instancing program with attributes position, i_transform and i_color
+     * @param meshBuffer VBO holding tightly packed vec2 positions of the mesh
+     * @param meshVertexCount number of vertices in meshBuffer
+     * @return true if every attribute the batch needs is active in program
+     */
+    bool init(const ShaderProgram& program, GLuint meshBuffer, GLsizei meshVertexCount);
+
+    /**
+     * Deletes the GL objects created by init()
+     */
+    void destroy();
+
+    /**
+     * Forgets the GL objects without deleting them, e.g. after context loss
+     */
+    void reset();
+
+    /**
+     * Re-seeds the batch with count instances scattered over the viewport
+     * @param count number of instances to draw
+     * @param seed seed for the instance placement, spin and color phase
+     */
+    void setInstanceCount(size_t count, uint32_t seed);
+
+    size_t instanceCount() const { return mPositionX.size(); }
+
+    /**
+     * @return true once init() has succeeded, i.e. draw() will actually draw
+     */
+    bool ready() const { return mVaoID != 0; }
+
+    /**
+     * Animates every instance to the given time and packs the result into
+     * the upload staging array
+     * @param elapsedTime seconds since rendering started
+     */
+    void update(float elapsedTime);
+
+    /**
+     * Streams the packed instances and issues the instanced draw.  The
+     * batch's program must be current.
+     * @param stream ring the instance data is written to this frame
+     */
+    void draw(StreamingVertexBuffer& stream);
+
+private:
+    GLuint mVaoID;
+    GLsizei mMeshVertexCount;
+    GLint mTransformAttrib;
+    GLint mColorAttrib;
+
+    // structure-of-arrays instance state
+    std::vector<float> mPositionX;
+    std::vector<float> mPositionY;
+    std::vector<float> mBaseAngle;
+    std::vector<float> mSpin;
+    std::vector<float> mScale;
+    std::vector<float> mColorPhase;
+
+    /**
+     * packed upload staging, rebuilt by update()
+     */
+    std::vector<InstanceVertex> mPacked;
+};
+
+#endif //JNIDEMO_INSTANCEDBATCH_H
@@ -0,0 +1,48 @@
+#include "jnibridge.h"
+#include <android/log.h>
+
+#define  LOG_TAG    "jnibridge"
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+JniClasses gJniClasses;
+
+/**
+ * @return a global reference to the named class, or nullptr with the
+ *         lookup's exception cleared
+ */
+static jclass globalClass(JNIEnv* env, const char* name) {
+    jclass local = env->FindClass(name);
+    if (!local) {
+        env->ExceptionClear();
+        LOGE("class %s not found", name);
+        return nullptr;
+    }
+    jclass global = (jclass) env->NewGlobalRef(local);
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+/**
+ * Binds every native of JniHooks up front with RegisterNatives, so none of
+ * them is resolved by a symbol lookup on its first call, and caches the
+ * classes the natives use.
+ */
+extern "C" JNIEXPORT jint JNICALL
+JNI_OnLoad(JavaVM* vm, void* reserved) {
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv((void**) &env, JNI_VERSION_1_6) != JNI_OK) {
+        return JNI_ERR;
+    }
+    gJniClasses.string = globalClass(env, "java/lang/String");
+    jclass hooks = env->FindClass(JNIDEMO_HOOKS_CLASS);
+    if (!gJniClasses.string || !hooks) {
+        return JNI_ERR;
+    }
+    bool registered = registerGraphicsNatives(env, hooks) && registerStringNatives(env, hooks);
+    env->DeleteLocalRef(hooks);
+    if (!registered) {
+        LOGE("could not register the natives of %s", JNIDEMO_HOOKS_CLASS);
+        return JNI_ERR;
+    }
+    return JNI_VERSION_1_6;
+}
@@ -0,0 +1,38 @@
+#ifndef JNIDEMO_JNIBRIDGE_H
+#define JNIDEMO_JNIBRIDGE_H
+
+#include <jni.h>
+
+/**
+ * Java class every native method is registered on
+ */
+#define JNIDEMO_HOOKS_CLASS "com/jeffcreswell/jniopengl/jni/JniHooks"
+
+/**
+ * Classes the natives need, looked up once by JNI_OnLoad and held as global
+ * references for the life of the process, so no native has to FindClass
+ * (a string compare and class loader walk) on every call.
+ */
+struct JniClasses {
+    jclass string;
+};
+
+/**
+ * Filled in by JNI_OnLoad before any native can run; plain data, so loading
+ * the library runs no static constructors
+ */
+extern JniClasses gJniClasses;
+
+/**
+ * Registers the renderer's natives (gles3jnidemo.cpp) on the JniHooks class
+ * @return false if any of them could not be registered
+ */
+bool registerGraphicsNatives(JNIEnv* env, jclass hooks);
+
+/**
+ * Registers the phrase generator's natives (stringsjnidemo.cpp) on the JniHooks class
+ * @return false if any of them could not be registered
+ */
+bool registerStringNatives(JNIEnv* env, jclass hooks);
+
+#endif //JNIDEMO_JNIBRIDGE_H
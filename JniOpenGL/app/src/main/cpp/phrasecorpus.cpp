@@ -0,0 +1,266 @@
+#include "phrasecorpus.h"
+#include "textencoding.h"
+#include <cstring>
+
+// The corpora are constexpr tables of pointers into string literals, so they
+// are emitted as constant data: no heap, and no static constructors run when
+// the library is loaded.
+
+/**
+ * These will be the first adjective, with a -ly added to modify the second adjective
+ */
+static constexpr CorpusWord kAdjective1Words[] = {
+        "Abaft",
+        "Abandoned",
+        "Abased",
+        "Abashed",
+        "Abasic",
+        "Abbatial",
+        "Abdicable",
+        "Abdicant",
+        "Abdicative",
+        "Abdominal",
+        "Abdominous",
+        "Abducent",
+        "Aberrant",
+        "Aberrational",
+        "Abeyant",
+        "Abhorrent",
+        "Abiotic",
+        "Ablaze",
+        "Able",
+        "Ablebodied",
+        "Ablutophobic",
+        "Abnormal",
+        "Abolitionary",
+        "Abominable",
+        "Aboriginal",
+        "Above",
+        "Aboveground",
+        "Abrupt",
+        "Absent",
+        "Absentminded",
+        "Absolute",
+        "Absolutistic",
+        "Abstract",
+        "Abstracted",
+        "Absurd",
+        "Abusive",
+        "Abysmal",
+        "Abyssal"
+};
+/**
+ * These will be the primary adjectives to modify the animal
+ */
+static constexpr CorpusWord kAdjective2Words[] = {
+        "Nyctophobic",
+        "Nylon",
+        "OAFISH",
+        "OBEDIENT",
+        "OBELISKOID",
+        "OBESE",
+        "OBJECTIVE",
+        "OBLIVIOUS",
+        "OBLONG",
+        "OBNOXIOUS",
+        "OBSCENE",
+        "OBSEQUIOUS",
+        "OBSERVANT",
+        "OBSESSIVE",
+        "OBSIDIAN",
+        "OBSOLETE",
+        "OBTUSE",
+        "OBVIOUS",
+        "OCCASIONAL",
+        "OCCUPATIONAL",
+        "OCEANGOING",
+        "OCEANIC",
+        "OCEANLIKE",
+        "OCEANOGRAPHIC",
+        "OCEANOGRAPHICAL",
+        "OCHRE",
+        "OCTAGONAL"
+};
+/**
+ * Animals to be described
+ */
+static constexpr CorpusWord kAnimalWords[] = {
+        "maltesedog",
+        "mamba",
+        "mamenchisaurus",
+        "mammal",
+        "mammoth",
+        "manatee",
+        "mandrill",
+        "mangabey",
+        "manta",
+        "mantaray",
+        "mantid",
+        "mantis",
+        "mantisray",
+        "manxcat",
+        "mara",
+        "marabou",
+        "marbledmurrelet",
+        "mare",
+        "marlin",
+        "marmoset",
+        "marmot",
+        "marten",
+        "martin",
+        "massasauga",
+        "massospondylus",
+        "mastiff",
+        "mastodon",
+        "mayfly",
+        "meadowhawk",
+        "meadowlark",
+        "mealworm",
+        "meerkat",
+        "megalosaurus",
+        "megalotomusquinquespinosus",
+        "megaraptor",
+        "merganser",
+        "merlin",
+        "metalmarkbutterfly",
+        "metamorphosis",
+        "mice",
+        "microvenator",
+        "midge",
+        "milksnake",
+        "milkweedbug",
+        "millipede",
+        "minibeast",
+        "mink",
+        "minnow",
+        "mite",
+        "moa",
+        "mockingbird",
+        "mole",
+        "mollies",
+        "mollusk",
+        "molly",
+        "monarch",
+        "mongoose",
+        "mongrel"
+};
+
+/**
+ * @return length of the longest of count words
+ */
+static constexpr uint32_t longestWord(const CorpusWord* words, size_t count) {
+    uint32_t longest = 0;
+    for (size_t i = 0; i < count; i++) {
+        longest = words[i].length > longest ? words[i].length : longest;
+    }
+    return longest;
+}
+
+/**
+ * @return true if none of count words has a byte outside ASCII
+ */
+static constexpr bool allAscii(const CorpusWord* words, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        for (uint32_t c = 0; c < words[i].length; c++) {
+            if ((unsigned char) words[i].text[c] >= 0x80) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<size_t N>
+static constexpr WordList wordList(const CorpusWord (&words)[N]) {
+    // built-in lists have no UTF-16 form of their own, see the static_assert below
+    return WordList{words, (uint32_t) N, longestWord(words, N), nullptr, nullptr, 0, nullptr, nullptr};
+}
+
+static_assert(allAscii(kAdjective1Words, sizeof(kAdjective1Words) / sizeof(kAdjective1Words[0]))
+              && allAscii(kAdjective2Words, sizeof(kAdjective2Words) / sizeof(kAdjective2Words[0]))
+              && allAscii(kAnimalWords, sizeof(kAnimalWords) / sizeof(kAnimalWords[0])),
+              "built-in words must be ASCII, so their UTF-16 is their bytes widened");
+
+static constexpr PhraseCorpus kBuiltinCorpus = {
+        wordList(kAdjective1Words),
+        wordList(kAdjective2Words),
+        wordList(kAnimalWords)
+};
+
+const size_t kBuiltinMaxPhraseLength = kBuiltinCorpus.maxPhraseLength();
+static_assert(kBuiltinCorpus.maxPhraseLength() + 1 <= kBuiltinPhraseBufferBytes,
+              "kBuiltinPhraseBufferBytes is too small for the longest built-in phrase");
+
+const PhraseCorpus& builtinCorpus() {
+    return kBuiltinCorpus;
+}
+
+/**
+ * Copies a word and returns the position just past it
+ */
+static inline char* appendWord(char* out, CorpusWord word) {
+    memcpy(out, word.text, word.length);
+    return out + word.length;
+}
+
+size_t phraseLength(const PhraseCorpus& corpus, const PhraseIndices& indices) {
+    size_t length = corpus.animal[indices.animal].length;
+    if (indices.wordCount >= 2) {
+        length += corpus.adjective2[indices.adjective2].length + 1;
+    }
+    if (indices.wordCount >= 3) {
+        length += corpus.adjective1[indices.adjective1].length + 3;
+    }
+    return length;
+}
+
+size_t writePhrase(const PhraseCorpus& corpus, const PhraseIndices& indices, char* out) {
+    char* end = out;
+    if (indices.wordCount >= 3) {
+        end = appendWord(end, corpus.adjective1[indices.adjective1]);
+        memcpy(end, "ly ", 3);
+        end += 3;
+    }
+    if (indices.wordCount >= 2) {
+        end = appendWord(end, corpus.adjective2[indices.adjective2]);
+        *end++ = ' ';
+    }
+    end = appendWord(end, corpus.animal[indices.animal]);
+    *end = '\0';
+    return (size_t) (end - out);
+}
+
+/**
+ * Appends the UTF-16 form of word index of list and returns the position just past it
+ */
+static inline uint16_t* appendWordUtf16(uint16_t* out, const WordList& list, uint32_t index) {
+    if (list.units) {
+        uint32_t begin = list.unitOffsets[index];
+        uint32_t length = list.unitOffsets[index + 1] - begin;
+        // like WordList::operator[], never let a bad entry overrun the phrase buffer
+        if (list.unitOffsets[index + 1] < begin || length > list.maxLength) {
+            return out;
+        }
+        memcpy(out, list.units + begin, length * sizeof(uint16_t));
+        return out + length;
+    }
+    CorpusWord word = list[index];
+    widenAscii(word.text, word.length, out);
+    return out + word.length;
+}
+
+size_t writePhraseUtf16(const PhraseCorpus& corpus, const PhraseIndices& indices, uint16_t* out) {
+    uint16_t* end = out;
+    if (indices.wordCount >= 3) {
+        end = appendWordUtf16(end, corpus.adjective1, indices.adjective1);
+        *end++ = 'l';
+        *end++ = 'y';
+        *end++ = ' ';
+    }
+    if (indices.wordCount >= 2) {
+        end = appendWordUtf16(end, corpus.adjective2, indices.adjective2);
+        *end++ = ' ';
+    }
+    end = appendWordUtf16(end, corpus.animal, indices.animal);
+    return (size_t) (end - out);
+}
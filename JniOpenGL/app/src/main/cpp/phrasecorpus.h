@@ -0,0 +1,166 @@
+#ifndef JNIDEMO_PHRASECORPUS_H
+#define JNIDEMO_PHRASECORPUS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * One corpus word with its length worked out at compile time
+ */
+struct CorpusWord {
+    const char* text;
+    uint32_t length;
+
+    constexpr CorpusWord() : text(""), length(0) {
+    }
+
+    constexpr CorpusWord(const char* text, uint32_t length) : text(text), length(length) {
+    }
+
+    template<size_t N>
+    constexpr CorpusWord(const char (&literal)[N]) : text(literal), length(N - 1) {
+    }
+};
+
+/**
+ * A table of corpus words, e.g. all the animals.  The words either come
+ * from an array of CorpusWords (the built-in tables) or from a packed
+ * offsets index over a block of string bytes (a mapped corpus file).
+ */
+struct WordList {
+    /**
+     * the words, or nullptr if they are packed
+     */
+    const CorpusWord* words;
+    uint32_t count;
+    /**
+     * length of the longest word, so phrase buffers can be sized up front
+     */
+    uint32_t maxLength;
+    /**
+     * packed form: word i is bytes[offsets[i], offsets[i + 1])
+     */
+    const uint32_t* offsets;
+    const char* bytes;
+    uint32_t bytesLength;
+    /**
+     * UTF-16 form of a list that isn't pure ASCII: word i is
+     * units[unitOffsets[i], unitOffsets[i + 1]).  nullptr for ASCII lists,
+     * whose UTF-16 is simply their bytes widened.
+     */
+    const uint16_t* units;
+    const uint32_t* unitOffsets;
+
+    /**
+     * @param index word index, below count
+     * @return the word; a packed word with an out of range offset reads as empty
+     */
+    CorpusWord operator[](uint32_t index) const {
+        if (words) {
+            return words[index];
+        }
+        uint32_t begin = offsets[index];
+        uint32_t end = offsets[index + 1];
+        if (begin > end || end > bytesLength || end - begin > maxLength) {
+            return CorpusWord();
+        }
+        return CorpusWord(bytes + begin, end - begin);
+    }
+};
+
+/**
+ * Everything a phrase is built from.  A phrase is one of
+ * "{adjective1}ly {adjective2} {animal}", "{adjective2} {animal}" or "{animal}".
+ */
+struct PhraseCorpus {
+    /**
+     * these get "ly" appended to modify the second adjective
+     */
+    WordList adjective1;
+    /**
+     * the primary adjectives modifying the animal
+     */
+    WordList adjective2;
+    /**
+     * animals to be described
+     */
+    WordList animal;
+
+    /**
+     * @return length of the longest phrase this corpus can produce, excluding the terminator
+     */
+    constexpr size_t maxPhraseLength() const {
+        return (size_t) adjective1.maxLength + 3 + adjective2.maxLength + 1 + animal.maxLength;
+    }
+};
+
+/**
+ * Which words make up one phrase
+ */
+struct PhraseIndices {
+    uint32_t adjective1;
+    uint32_t adjective2;
+    uint32_t animal;
+    /**
+     * 1 to 3: just the animal, adjective2 and the animal, or all three words
+     */
+    uint32_t wordCount;
+};
+
+/**
+ * SplitMix64's finalizer: a cheap, well-distributed 64-bit mix.  Phrase
+ * generators hash seeds and counters with it to get random bits that depend
+ * only on their inputs.
+ */
+inline uint64_t mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @return the corpus compiled into the library.  It lives entirely in
+ *         read-only data; nothing runs at load time to build it.
+ */
+const PhraseCorpus& builtinCorpus();
+
+/**
+ * Longest phrase the built-in corpus can produce, excluding the terminator
+ */
+extern const size_t kBuiltinMaxPhraseLength;
+
+/**
+ * Bytes a buffer needs to hold any built-in phrase and its terminator
+ */
+static const size_t kBuiltinPhraseBufferBytes = 128;
+
+/**
+ * @return length of the phrase writePhrase would write for indices, excluding the terminator
+ */
+size_t phraseLength(const PhraseCorpus& corpus, const PhraseIndices& indices);
+
+/**
+ * Writes a phrase as UTF-16, as Java strings hold it, without allocating
+ * @param corpus where the words come from
+ * @param indices which words to use; each index must be within its word list
+ * @param out receives the phrase, unterminated; must hold corpus.maxPhraseLength()
+ *            code units, which always suffices since no character takes more
+ *            UTF-16 units than UTF-8 bytes
+ * @return length of the phrase in UTF-16 code units
+ */
+size_t writePhraseUtf16(const PhraseCorpus& corpus, const PhraseIndices& indices, uint16_t* out);
+
+/**
+ * Writes a phrase into a caller-supplied buffer without allocating
+ * @param corpus where the words come from
+ * @param indices which words to use; each index must be within its word list
+ * @param out receives the phrase and a terminating NUL; must hold
+ *            corpus.maxPhraseLength() + 1 bytes
+ * @return length of the phrase, excluding the terminator
+ */
+size_t writePhrase(const PhraseCorpus& corpus, const PhraseIndices& indices, char* out);
+
+#endif //JNIDEMO_PHRASECORPUS_H
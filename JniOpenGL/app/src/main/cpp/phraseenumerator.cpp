@@ -0,0 +1,101 @@
+#include "phraseenumerator.h"
+
+static const int kFeistelRounds = 4;
+
+/**
+ * Largest space we enumerate; keeps the Feistel domain within 64 bits
+ */
+static const uint64_t kMaxSize = 1ull << 62;
+
+/**
+ * @return a * b + c, or kMaxSize if that would reach kMaxSize
+ */
+static uint64_t mulAddCapped(uint64_t a, uint64_t b, uint64_t c) {
+    uint64_t product;
+    if (__builtin_mul_overflow(a, b, &product) || product >= kMaxSize || kMaxSize - product <= c) {
+        return kMaxSize;
+    }
+    return product + c;
+}
+
+PhraseEnumerator::PhraseEnumerator(const PhraseCorpus& corpus, uint64_t key) :
+        mKey(mix64(key)),
+        mAdjective1Count(corpus.adjective1.count),
+        mAdjective2Count(corpus.adjective2.count),
+        mAnimalCount(corpus.animal.count),
+        mSize(0),
+        mHalfBits(1),
+        mHalfMask(1),
+        mPosition(0) {
+    // A*B*C + B*C + C == (A*B + B + 1) * C
+    uint64_t perAnimal = mulAddCapped(mAdjective1Count, mAdjective2Count, mAdjective2Count + 1);
+    uint64_t size = mulAddCapped(perAnimal, mAnimalCount, 0);
+    if (size >= kMaxSize) {
+        return;
+    }
+    mSize = size;
+    // smallest even bit count covering the space, so the domain splits into
+    // equal halves and is at most 4x the space: cycle walking takes under 4
+    // steps on average
+    while (mHalfBits < 31 && (1ull << (2 * mHalfBits)) < mSize) {
+        mHalfBits++;
+    }
+    mHalfMask = (1ull << mHalfBits) - 1;
+}
+
+uint64_t PhraseEnumerator::feistel(uint64_t value) const {
+    uint64_t left = value >> mHalfBits;
+    uint64_t right = value & mHalfMask;
+    for (int round = 0; round < kFeistelRounds; round++) {
+        uint64_t roundKey = mKey + (uint64_t) round * 0x9e3779b97f4a7c15ull;
+        uint64_t mixed = left ^ (mix64(right ^ roundKey) & mHalfMask);
+        left = right;
+        right = mixed;
+    }
+    return (left << mHalfBits) | right;
+}
+
+uint64_t PhraseEnumerator::permute(uint64_t position) const {
+    // the Feistel network permutes the whole power-of-four domain; walking
+    // the cycle until we're back inside [0, size) permutes the space itself
+    uint64_t rank = feistel(position);
+    while (rank >= mSize) {
+        rank = feistel(rank);
+    }
+    return rank;
+}
+
+PhraseIndices PhraseEnumerator::unrank(uint64_t rank) const {
+    PhraseIndices indices;
+    const uint64_t twoWordCount = mAdjective2Count * mAnimalCount;
+    const uint64_t threeWordCount = mAdjective1Count * twoWordCount;
+    indices.adjective1 = 0;
+    indices.adjective2 = 0;
+    if (rank < threeWordCount) {
+        indices.wordCount = 3;
+        indices.animal = (uint32_t) (rank % mAnimalCount);
+        indices.adjective2 = (uint32_t) (rank / mAnimalCount % mAdjective2Count);
+        indices.adjective1 = (uint32_t) (rank / twoWordCount);
+    } else if (rank < threeWordCount + twoWordCount) {
+        rank -= threeWordCount;
+        indices.wordCount = 2;
+        indices.animal = (uint32_t) (rank % mAnimalCount);
+        indices.adjective2 = (uint32_t) (rank / mAnimalCount);
+    } else {
+        indices.wordCount = 1;
+        indices.animal = (uint32_t) (rank - threeWordCount - twoWordCount);
+    }
+    return indices;
+}
+
+PhraseIndices PhraseEnumerator::at(uint64_t position) const {
+    return unrank(permute(position));
+}
+
+bool PhraseEnumerator::next(PhraseIndices* indices) {
+    if (mPosition >= mSize) {
+        return false;
+    }
+    *indices = at(mPosition++);
+    return true;
+}
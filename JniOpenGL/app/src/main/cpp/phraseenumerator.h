@@ -0,0 +1,81 @@
+#ifndef JNIDEMO_PHRASEENUMERATOR_H
+#define JNIDEMO_PHRASEENUMERATOR_H
+
+#include "phrasecorpus.h"
+#include <cstdint>
+
+/**
+ * Walks every distinct phrase of a corpus exactly once, in a shuffled order
+ * determined by a key, using O(1) memory.
+ *
+ * Each phrase has a rank in the mixed-radix space of all phrases: first the
+ * A*B*C three-word phrases, then the B*C two-word phrases, then the C lone
+ * animals (A, B and C being the word list sizes).  Position i of the
+ * sequence is the phrase whose rank is permute(i), where permute is a keyed
+ * bijection: a four-round Feistel network over the smallest power-of-four
+ * domain covering the space, cycle-walked until the result lands inside it.
+ * Being a bijection, it can never produce a rank twice, and any position can
+ * be computed directly, so the sequence is seekable and can be split
+ * between independent consumers by position.
+ */
+class PhraseEnumerator {
+public:
+    /**
+     * @param corpus corpus whose phrases to enumerate; must outlive the enumerator
+     * @param key selects one of the possible orders
+     */
+    PhraseEnumerator(const PhraseCorpus& corpus, uint64_t key);
+
+    /**
+     * @return number of distinct phrases, or 0 if the corpus is empty or its
+     *         space doesn't fit in 62 bits
+     */
+    uint64_t size() const { return mSize; }
+
+    uint64_t position() const { return mPosition; }
+
+    /**
+     * Moves to a position in the sequence; next() then returns that phrase
+     */
+    void seek(uint64_t position) { mPosition = position; }
+
+    /**
+     * Returns the phrase at the current position and advances
+     * @param indices receives the phrase's words
+     * @return false once all size() phrases have been returned
+     */
+    bool next(PhraseIndices* indices);
+
+    /**
+     * @param position index into the sequence, below size()
+     * @return the phrase at that position, without moving
+     */
+    PhraseIndices at(uint64_t position) const;
+
+    /**
+     * @return the rank (see class comment) of the phrase at a position
+     */
+    uint64_t permute(uint64_t position) const;
+
+    /**
+     * @return the words of the phrase with a given rank
+     */
+    PhraseIndices unrank(uint64_t rank) const;
+
+private:
+    uint64_t feistel(uint64_t value) const;
+
+    uint64_t mKey;
+    uint64_t mAdjective1Count;
+    uint64_t mAdjective2Count;
+    uint64_t mAnimalCount;
+    uint64_t mSize;
+    /**
+     * bits in each Feistel half; the permuted domain is 4^mHalfBits
+     */
+    uint32_t mHalfBits;
+    uint64_t mHalfMask;
+    uint64_t mPosition;
+};
+
+#endif //JNIDEMO_PHRASEENUMERATOR_H
@@ -0,0 +1,114 @@
+#include "phrasegenerator.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/**
+ * SplitMix64's increment
+ */
+static const uint64_t kGoldenGamma = 0x9e3779b97f4a7c15ull;
+
+/**
+ * Fewest phrases worth handing to a worker; smaller chunks cost more in
+ * scheduling than they win in balance
+ */
+static const size_t kMinChunkPhrases = 4096;
+
+/**
+ * Chunks per thread, so a slow core doesn't hold up the whole batch
+ */
+static const size_t kChunksPerThread = 4;
+
+/**
+ * @return a uniformly distributed value in [0, range), from 32 random bits
+ */
+static inline uint32_t scaled(uint32_t bits, uint32_t range) {
+    return (uint32_t) (((uint64_t) bits * range) >> 32);
+}
+
+PhraseIndices seededPhrase(const PhraseCorpus& corpus, uint64_t seed, uint64_t index) {
+    const uint64_t state = mix64(seed) + 2 * index * kGoldenGamma;
+    const uint64_t words = mix64(state + kGoldenGamma);
+    const uint64_t more = mix64(state + 2 * kGoldenGamma);
+    PhraseIndices indices;
+    indices.adjective1 = scaled((uint32_t) words, corpus.adjective1.count);
+    indices.adjective2 = scaled((uint32_t) (words >> 32), corpus.adjective2.count);
+    indices.animal = scaled((uint32_t) more, corpus.animal.count);
+    indices.wordCount = 1 + scaled((uint32_t) (more >> 32), 3);
+    return indices;
+}
+
+size_t generatePhrases(const PhraseCorpus& corpus, uint64_t seed, uint64_t first, size_t count,
+                       char* bytes, size_t capacity, int32_t* offsetsAndLengths, WorkerPool& pool) {
+    if (count == 0) {
+        return 0;
+    }
+    // offsets are Java ints
+    capacity = std::min<size_t>(capacity, INT32_MAX);
+    const size_t chunkPhrases = std::max(kMinChunkPhrases,
+                                         (count + pool.concurrency() * kChunksPerThread - 1)
+                                         / (pool.concurrency() * kChunksPerThread));
+    const size_t chunkCount = (count + chunkPhrases - 1) / chunkPhrases;
+
+    // pass 1: lengths, and the bytes each chunk needs
+    std::vector<size_t> chunkOffsets(chunkCount + 1);
+    pool.run(chunkCount, [&](size_t chunk) {
+        const size_t begin = chunk * chunkPhrases;
+        const size_t end = std::min(count, begin + chunkPhrases);
+        size_t chunkBytes = 0;
+        for (size_t i = begin; i < end; i++) {
+            size_t length = phraseLength(corpus, seededPhrase(corpus, seed, first + i));
+            offsetsAndLengths[2 * i + 1] = (int32_t) length;
+            chunkBytes += length;
+        }
+        chunkOffsets[chunk + 1] = chunkBytes;
+    });
+
+    // prefix sum, cutting the batch short at the first phrase that doesn't fit
+    size_t written = count;
+    size_t usedChunks = chunkCount;
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        if (chunkOffsets[chunk + 1] > capacity - chunkOffsets[chunk]) {
+            size_t position = chunkOffsets[chunk];
+            size_t i = chunk * chunkPhrases;
+            while ((size_t) offsetsAndLengths[2 * i + 1] <= capacity - position) {
+                position += (size_t) offsetsAndLengths[2 * i + 1];
+                i++;
+            }
+            written = i;
+            usedChunks = chunk + 1;
+            break;
+        }
+        chunkOffsets[chunk + 1] += chunkOffsets[chunk];
+    }
+
+    // pass 2: write each chunk at its offset
+    pool.run(usedChunks, [&](size_t chunk) {
+        const size_t begin = chunk * chunkPhrases;
+        const size_t end = std::min(written, begin + chunkPhrases);
+        char phrase[kBuiltinPhraseBufferBytes];
+        std::vector<char> longPhrase;
+        char* staging = phrase;
+        if (corpus.maxPhraseLength() + 1 > sizeof(phrase)) {
+            longPhrase.resize(corpus.maxPhraseLength() + 1);
+            staging = longPhrase.data();
+        }
+        size_t position = chunkOffsets[chunk];
+        for (size_t i = begin; i < end; i++) {
+            PhraseIndices indices = seededPhrase(corpus, seed, first + i);
+            size_t length = (size_t) offsetsAndLengths[2 * i + 1];
+            if (i + 1 < end) {
+                // the terminator lands where the next phrase of this chunk goes
+                writePhrase(corpus, indices, bytes + position);
+            } else {
+                // the last phrase's terminator would spill into another
+                // chunk's slice (or past the buffer), so stage it
+                writePhrase(corpus, indices, staging);
+                memcpy(bytes + position, staging, length);
+            }
+            offsetsAndLengths[2 * i] = (int32_t) position;
+            position += length;
+        }
+    });
+    return written;
+}
@@ -0,0 +1,43 @@
+#ifndef JNIDEMO_PHRASEGENERATOR_H
+#define JNIDEMO_PHRASEGENERATOR_H
+
+#include "phrasecorpus.h"
+#include "workerpool.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Picks phrase number index of the random sequence selected by seed.
+ *
+ * The random bits are a pure function of (seed, index): a SplitMix64 stream
+ * keyed by seed and read at position 2 * index, i.e. a counter-based
+ * generator.  Any phrase of the sequence can be computed directly, so
+ * workers need no shared or jumped-ahead state, and splitting the sequence
+ * between any number of threads yields exactly the same phrases.
+ *
+ * @param corpus where the words come from; every word list must be non-empty
+ * @return the words of the phrase
+ */
+PhraseIndices seededPhrase(const PhraseCorpus& corpus, uint64_t seed, uint64_t index);
+
+/**
+ * Generates phrases [first, first + count) of seed's sequence in parallel,
+ * packed back to back in order, as randomPhrasesToBuffer lays them out.
+ *
+ * Runs in two passes over contiguous chunks of the range: the first works
+ * out every phrase's length and each chunk's byte total, the second writes
+ * each chunk at its prefix-summed offset.  Chunks therefore write disjoint
+ * slices of both outputs, and the result is identical whatever the number
+ * of threads.
+ *
+ * @param bytes receives the UTF-8 phrase bytes, unterminated
+ * @param capacity bytes available at bytes
+ * @param offsetsAndLengths receives the offset and length of phrase i at
+ *                          indices 2 * i and 2 * i + 1; must hold 2 * count ints
+ * @param pool workers to spread the chunks across
+ * @return number of phrases written; fewer than count if bytes filled up
+ */
+size_t generatePhrases(const PhraseCorpus& corpus, uint64_t seed, uint64_t first, size_t count,
+                       char* bytes, size_t capacity, int32_t* offsetsAndLengths, WorkerPool& pool);
+
+#endif //JNIDEMO_PHRASEGENERATOR_H
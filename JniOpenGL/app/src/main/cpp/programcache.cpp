@@ -0,0 +1,266 @@
+#include "programcache.h"
+#include <android/log.h>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#define  LOG_TAG    "programcache"
+#define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+ProgramCache gProgramCache;
+
+/**
+ * "JDPB" -- jnidemo program binary
+ */
+static const uint32_t kEntryMagic = 0x4250444a;
+/**
+ * Bump whenever the entry layout or key derivation changes
+ */
+static const uint32_t kEntryVersion = 1;
+static const char* const kEntrySuffix = ".glbin";
+/**
+ * Appended to an entry's name while store() writes it
+ */
+static const char* const kTemporarySuffix = ".tmp";
+
+/**
+ * Layout of the start of every cache entry; the program binary follows
+ */
+struct ProgramCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t binaryFormat;
+    uint32_t binaryLength;
+    uint64_t binaryChecksum;
+};
+static_assert(sizeof(ProgramCacheHeader) == 32, "cache entry header must not contain padding");
+
+/**
+ * 64-bit FNV-1a, continued from hash
+ */
+static uint64_t fnv1a(uint64_t hash, const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*) data;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static const uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+
+/**
+ * @return true if name ends with suffix
+ */
+static bool endsWith(const std::string& name, const char* suffix) {
+    const size_t length = strlen(suffix);
+    return name.size() >= length && name.compare(name.size() - length, length, suffix) == 0;
+}
+
+/**
+ * Hashes a string including its terminator, so ("ab", "c") and ("a", "bc")
+ * produce different keys.  A null string hashes like an empty one.
+ */
+static uint64_t fnv1aString(uint64_t hash, const char* string) {
+    if (!string) {
+        string = "";
+    }
+    return fnv1a(hash, string, strlen(string) + 1);
+}
+
+ProgramCache::ProgramCache() :
+        mHits(0),
+        mMisses(0),
+        mEvictions(0) {
+}
+
+void ProgramCache::setDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(mDirectoryLock);
+    mDirectory = directory;
+    if (!mDirectory.empty() && mkdir(mDirectory.c_str(), 0700) != 0 && errno != EEXIST) {
+        LOGE("could not create program cache directory %s: %s", mDirectory.c_str(), strerror(errno));
+        mDirectory.clear();
+    }
+}
+
+bool ProgramCache::usable() {
+    {
+        std::lock_guard<std::mutex> lock(mDirectoryLock);
+        if (mDirectory.empty()) {
+            return false;
+        }
+    }
+    GLint formats = 0;
+    gGl.GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+uint64_t ProgramCache::key(const char* vertexSource, const char* fragmentSource) const {
+    uint64_t hash = kFnvOffsetBasis;
+    hash = fnv1aString(hash, vertexSource);
+    hash = fnv1aString(hash, fragmentSource);
+    hash = fnv1aString(hash, (const char*) gGl.GetString(GL_VENDOR));
+    hash = fnv1aString(hash, (const char*) gGl.GetString(GL_RENDERER));
+    hash = fnv1aString(hash, (const char*) gGl.GetString(GL_VERSION));
+    return hash;
+}
+
+std::string ProgramCache::entryPath(const char* label, uint64_t key) const {
+    char name[64];
+    snprintf(name, sizeof(name), "-%016" PRIx64, key);
+    std::lock_guard<std::mutex> lock(mDirectoryLock);
+    return mDirectory + "/" + label + name + kEntrySuffix;
+}
+
+void ProgramCache::evict(const std::string& path) {
+    if (unlink(path.c_str()) == 0) {
+        mEvictions++;
+        LOGI("evicted %s", path.c_str());
+    }
+}
+
+void ProgramCache::evictOthers(const char* label, uint64_t keepKey) {
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(mDirectoryLock);
+        directory = mDirectory;
+    }
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return;
+    }
+    std::string prefix = std::string(label) + "-";
+    std::string keep = entryPath(label, keepKey);
+    std::vector<std::string> stale;
+    const std::string temporarySuffix = std::string(kEntrySuffix) + kTemporarySuffix;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+        // a temporary file still here was left by a store() that never finished
+        bool temporary = endsWith(name, temporarySuffix.c_str());
+        if (!temporary && !endsWith(name, kEntrySuffix)) {
+            continue;
+        }
+        std::string path = directory + "/" + name;
+        if (temporary || path != keep) {
+            stale.push_back(path);
+        }
+    }
+    closedir(dir);
+    for (const std::string& path : stale) {
+        evict(path);
+    }
+}
+
+GLuint ProgramCache::load(const char* label, const char* vertexSource, const char* fragmentSource) {
+    if (!usable()) {
+        return 0;
+    }
+    const uint64_t entryKey = key(vertexSource, fragmentSource);
+    const std::string path = entryPath(label, entryKey);
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        mMisses++;
+        return 0;
+    }
+
+    ProgramCacheHeader header;
+    std::vector<uint8_t> binary;
+    struct stat status;
+    // the entry must be exactly header + binary, nothing truncated or
+    // appended; checking the size first means a corrupt length can't make
+    // us allocate more than the file holds
+    bool valid = fstat(fileno(file), &status) == 0
+                 && fread(&header, sizeof(header), 1, file) == 1
+                 && header.magic == kEntryMagic
+                 && header.version == kEntryVersion
+                 && header.key == entryKey
+                 && header.binaryLength > 0
+                 && (uint64_t) status.st_size == sizeof(header) + (uint64_t) header.binaryLength;
+    if (valid) {
+        binary.resize(header.binaryLength);
+        valid = fread(binary.data(), 1, binary.size(), file) == binary.size()
+                && fnv1a(kFnvOffsetBasis, binary.data(), binary.size()) == header.binaryChecksum;
+    }
+    fclose(file);
+    if (!valid) {
+        LOGE("program cache entry %s is corrupt", path.c_str());
+        evict(path);
+        mMisses++;
+        return 0;
+    }
+
+    GLuint program = gGl.CreateProgram();
+    gGl.ProgramBinary(program, header.binaryFormat, binary.data(), (GLsizei) binary.size());
+    GLint linkStatus = GL_FALSE;
+    gGl.GetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE) {
+        // e.g. the driver was updated in a way its version string doesn't show
+        LOGI("driver rejected cached program %s", path.c_str());
+        gGl.DeleteProgram(program);
+        evict(path);
+        mMisses++;
+        return 0;
+    }
+    mHits++;
+    LOGI("loaded program %s from cache (%u bytes)", label, header.binaryLength);
+    return program;
+}
+
+bool ProgramCache::store(const char* label, const char* vertexSource, const char* fragmentSource,
+                         GLuint program) {
+    if (!program || !usable()) {
+        return false;
+    }
+    GLint length = 0;
+    gGl.GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return false;
+    }
+    std::vector<uint8_t> binary((size_t) length);
+    GLsizei written = 0;
+    GLenum format = 0;
+    gGl.GetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return false;
+    }
+    binary.resize((size_t) written);
+
+    ProgramCacheHeader header;
+    header.magic = kEntryMagic;
+    header.version = kEntryVersion;
+    header.key = key(vertexSource, fragmentSource);
+    header.binaryFormat = format;
+    header.binaryLength = (uint32_t) binary.size();
+    header.binaryChecksum = fnv1a(kFnvOffsetBasis, binary.data(), binary.size());
+
+    // write to a temporary file and rename it into place, so a crash
+    // mid-write never leaves a truncated entry under the real name
+    const std::string path = entryPath(label, header.key);
+    const std::string temporaryPath = path + kTemporarySuffix;
+    FILE* file = fopen(temporaryPath.c_str(), "wb");
+    if (!file) {
+        LOGE("could not write %s: %s", temporaryPath.c_str(), strerror(errno));
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+              && fwrite(binary.data(), 1, binary.size(), file) == binary.size();
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        LOGE("could not store program %s in cache", label);
+        unlink(temporaryPath.c_str());
+        return false;
+    }
+    evictOthers(label, header.key);
+    LOGI("stored program %s in cache (%u bytes)", label, header.binaryLength);
+    return true;
+}
@@ -0,0 +1,83 @@
+#ifndef JNIDEMO_PROGRAMCACHE_H
+#define JNIDEMO_PROGRAMCACHE_H
+
+#include "gldispatch.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+/**
+ * On-disk cache of linked program binaries, so a surface change or resume
+ * doesn't pay for compiling and linking our shaders from source again.
+ *
+ * Entries are keyed by a hash of the shader sources plus the GL vendor,
+ * renderer and version strings, since a binary is only valid for the exact
+ * driver that produced it.  Each entry is one file named
+ * <label>-<key>.glbin in the cache directory.  An entry that fails to
+ * validate or that the driver rejects is deleted, as is every other entry
+ * with the same label when a new binary is stored, so driver updates and
+ * shader edits don't leave stale binaries behind.
+ */
+class ProgramCache {
+public:
+    ProgramCache();
+
+    /**
+     * @param directory where to keep program binaries; created if missing.
+     *                  An empty path disables the cache.
+     */
+    void setDirectory(const std::string& directory);
+
+    /**
+     * Tries to create a linked program from a cached binary.  Must be called
+     * on the GL thread.
+     * @param label short name identifying the program, e.g. "triangle"
+     * @return a linked program ID, or 0 on a cache miss
+     */
+    GLuint load(const char* label, const char* vertexSource, const char* fragmentSource);
+
+    /**
+     * Saves the binary of a program linked from the given sources.  The
+     * program should have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+     * @return true if the binary was written
+     */
+    bool store(const char* label, const char* vertexSource, const char* fragmentSource, GLuint program);
+
+    uint32_t hits() const { return mHits; }
+    uint32_t misses() const { return mMisses; }
+    uint32_t evictions() const { return mEvictions; }
+
+private:
+    /**
+     * @return true if the cache is enabled and the driver can hand out binaries
+     */
+    bool usable();
+
+    /**
+     * @return cache key for a program built from these sources on the current driver
+     */
+    uint64_t key(const char* vertexSource, const char* fragmentSource) const;
+
+    std::string entryPath(const char* label, uint64_t key) const;
+
+    /**
+     * Deletes every entry with this label except the one for keepKey, and
+     * any temporary file an interrupted store() left behind
+     */
+    void evictOthers(const char* label, uint64_t keepKey);
+
+    void evict(const std::string& path);
+
+    mutable std::mutex mDirectoryLock;
+    std::string mDirectory;
+    uint32_t mHits;
+    uint32_t mMisses;
+    uint32_t mEvictions;
+};
+
+/**
+ * The program cache shared by every program the renderer builds
+ */
+extern ProgramCache gProgramCache;
+
+#endif //JNIDEMO_PROGRAMCACHE_H
@@ -0,0 +1,237 @@
+#include "shaderprogram.h"
+#include "glm/gtc/type_ptr.hpp"
+#include <android/log.h>
+#include <cstring>
+
+#define  LOG_TAG    "shaderprogram"
+#define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+
+/**
+ * @param type a GL uniform type, e.g. GL_FLOAT_VEC3
+ * @return size in bytes of one element of that type as we pass it to glUniform*
+ */
+static size_t uniformTypeBytes(GLenum type) {
+    switch (type) {
+        case GL_FLOAT:
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_BOOL:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_2D_ARRAY:
+            return 4;
+        case GL_FLOAT_VEC2:
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2:
+            return 8;
+        case GL_FLOAT_VEC3:
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3:
+            return 12;
+        case GL_FLOAT_VEC4:
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4:
+        case GL_FLOAT_MAT2:
+            return 16;
+        case GL_FLOAT_MAT3:
+            return 36;
+        case GL_FLOAT_MAT4:
+            return 64;
+        default:
+            // anything exotic gets a mat4 worth of shadow, which covers every
+            // type we can upload through the setters
+            return 64;
+    }
+}
+
+/**
+ * @return true if uniforms of this type are set through glUniform1i
+ */
+static bool isIntegerScalarType(GLenum type) {
+    switch (type) {
+        case GL_INT:
+        case GL_BOOL:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_2D_ARRAY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Strips the "[0]" suffix GL reports for array variables
+ */
+static std::string baseName(const char* name, GLsizei length) {
+    std::string result(name, (size_t) length);
+    size_t bracket = result.find('[');
+    if (bracket != std::string::npos) {
+        result.resize(bracket);
+    }
+    return result;
+}
+
+ShaderProgram::ShaderProgram() :
+        mProgram(0),
+        mUniformUploads(0),
+        mUniformUploadsSkipped(0) {
+}
+
+bool ShaderProgram::reflect(GLuint program) {
+    reset();
+    if (!program) {
+        return false;
+    }
+    mProgram = program;
+
+    GLint count = 0;
+    GLint maxLength = 0;
+    gGl.GetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+    gGl.GetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::vector<GLchar> name((size_t) maxLength + 1);
+    size_t shadowBytes = 0;
+    for (GLint i = 0; i < count; i++) {
+        GLsizei length = 0;
+        Variable uniform;
+        gGl.GetActiveUniform(program, (GLuint) i, (GLsizei) name.size(), &length,
+                             &uniform.size, &uniform.type, name.data());
+        uniform.name = baseName(name.data(), length);
+        uniform.location = gGl.GetUniformLocation(program, name.data());
+        if (uniform.location < 0) {
+            // members of uniform blocks are reported here too but have no location
+            continue;
+        }
+        uniform.shadowOffset = shadowBytes;
+        uniform.shadowBytes = uniformTypeBytes(uniform.type) * (size_t) uniform.size;
+        uniform.shadowValid = false;
+        shadowBytes += uniform.shadowBytes;
+        LOGI("uniform %s: type 0x%x size %d location %d\n",
+             uniform.name.c_str(), uniform.type, uniform.size, uniform.location);
+        mUniforms.push_back(uniform);
+    }
+    mShadow.assign(shadowBytes, 0);
+
+    count = 0;
+    maxLength = 0;
+    gGl.GetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+    gGl.GetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+    name.resize((size_t) maxLength + 1);
+    for (GLint i = 0; i < count; i++) {
+        GLsizei length = 0;
+        Variable attribute;
+        gGl.GetActiveAttrib(program, (GLuint) i, (GLsizei) name.size(), &length,
+                            &attribute.size, &attribute.type, name.data());
+        attribute.name = baseName(name.data(), length);
+        attribute.location = gGl.GetAttribLocation(program, name.data());
+        attribute.shadowOffset = 0;
+        attribute.shadowBytes = 0;
+        attribute.shadowValid = false;
+        LOGI("attribute %s: type 0x%x location %d\n",
+             attribute.name.c_str(), attribute.type, attribute.location);
+        mAttributes.push_back(attribute);
+    }
+    return true;
+}
+
+void ShaderProgram::reset() {
+    mProgram = 0;
+    mUniforms.clear();
+    mAttributes.clear();
+    mShadow.clear();
+}
+
+void ShaderProgram::use() const {
+    gGl.UseProgram(mProgram);
+}
+
+int ShaderProgram::uniformIndex(const char* name) const {
+    for (size_t i = 0; i < mUniforms.size(); i++) {
+        if (mUniforms[i].name == name) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+GLint ShaderProgram::attribLocation(const char* name) const {
+    for (const Variable& attribute : mAttributes) {
+        if (attribute.name == name) {
+            return attribute.location;
+        }
+    }
+    return -1;
+}
+
+bool ShaderProgram::bindUniformBlock(const char* name, GLuint binding) const {
+    if (!mProgram) {
+        return false;
+    }
+    GLuint blockIndex = gGl.GetUniformBlockIndex(mProgram, name);
+    if (blockIndex == GL_INVALID_INDEX) {
+        return false;
+    }
+    gGl.UniformBlockBinding(mProgram, blockIndex, binding);
+    return true;
+}
+
+bool ShaderProgram::updateShadow(int index, GLenum type, const void* value, size_t bytes) {
+    if (index < 0 || (size_t) index >= mUniforms.size()) {
+        return false;
+    }
+    Variable& uniform = mUniforms[index];
+    if (uniform.type != type && !(type == GL_INT && isIntegerScalarType(uniform.type))) {
+        // GL would reject the upload with GL_INVALID_OPERATION anyway;
+        // sampler and bool uniforms are set through the GL_INT setter
+        return false;
+    }
+    uint8_t* shadow = mShadow.data() + uniform.shadowOffset;
+    if (uniform.shadowValid && memcmp(shadow, value, bytes) == 0) {
+        mUniformUploadsSkipped++;
+        return false;
+    }
+    memcpy(shadow, value, bytes);
+    uniform.shadowValid = true;
+    mUniformUploads++;
+    return true;
+}
+
+void ShaderProgram::setUniform(int index, GLint value) {
+    if (updateShadow(index, GL_INT, &value, sizeof(value))) {
+        gGl.Uniform1iv(mUniforms[index].location, 1, &value);
+    }
+}
+
+void ShaderProgram::setUniform(int index, GLfloat value) {
+    if (updateShadow(index, GL_FLOAT, &value, sizeof(value))) {
+        gGl.Uniform1fv(mUniforms[index].location, 1, &value);
+    }
+}
+
+void ShaderProgram::setUniform(int index, const glm::vec2& value) {
+    if (updateShadow(index, GL_FLOAT_VEC2, glm::value_ptr(value), sizeof(value))) {
+        gGl.Uniform2fv(mUniforms[index].location, 1, glm::value_ptr(value));
+    }
+}
+
+void ShaderProgram::setUniform(int index, const glm::vec3& value) {
+    if (updateShadow(index, GL_FLOAT_VEC3, glm::value_ptr(value), sizeof(value))) {
+        gGl.Uniform3fv(mUniforms[index].location, 1, glm::value_ptr(value));
+    }
+}
+
+void ShaderProgram::setUniform(int index, const glm::vec4& value) {
+    if (updateShadow(index, GL_FLOAT_VEC4, glm::value_ptr(value), sizeof(value))) {
+        gGl.Uniform4fv(mUniforms[index].location, 1, glm::value_ptr(value));
+    }
+}
+
+void ShaderProgram::setUniform(int index, const glm::mat4& value) {
+    if (updateShadow(index, GL_FLOAT_MAT4, glm::value_ptr(value), sizeof(value))) {
+        gGl.UniformMatrix4fv(mUniforms[index].location, 1, GL_FALSE, glm::value_ptr(value));
+    }
+}
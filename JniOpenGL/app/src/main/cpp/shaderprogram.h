@@ -0,0 +1,123 @@
+#ifndef JNIDEMO_SHADERPROGRAM_H
+#define JNIDEMO_SHADERPROGRAM_H
+
+#include "gldispatch.h"
+#include "glm/glm.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * A linked shader program plus everything we learned about it at link time.
+ *
+ * Active uniforms and attributes are enumerated once by reflect(), so the
+ * render loop never pays for a glGetUniformLocation string lookup.  Every
+ * uniform also keeps a shadow copy of the last value sent to GL; setting a
+ * uniform to the value it already holds is dropped before it reaches the
+ * driver.
+ */
+class ShaderProgram {
+public:
+    /**
+     * An active uniform or attribute as reported by the driver
+     */
+    struct Variable {
+        /**
+         * name without any trailing "[0]" the driver adds for arrays
+         */
+        std::string name;
+        GLenum type;
+        /**
+         * number of array elements, 1 for non-arrays
+         */
+        GLint size;
+        GLint location;
+        /**
+         * where this uniform's shadow value lives in mShadow (unused for attributes)
+         */
+        size_t shadowOffset;
+        size_t shadowBytes;
+        bool shadowValid;
+    };
+
+    ShaderProgram();
+
+    /**
+     * Takes over a successfully linked program and enumerates its active
+     * uniforms and attributes.  Any previous program is forgotten, not deleted.
+     * @param program a linked GL program ID
+     * @return true if the program could be reflected, false if it was zero
+     */
+    bool reflect(GLuint program);
+
+    /**
+     * Forgets the current program without deleting it, e.g. after the EGL
+     * context that owned it went away
+     */
+    void reset();
+
+    GLuint id() const { return mProgram; }
+
+    /**
+     * Makes this program current.  Uniform setters below require that.
+     */
+    void use() const;
+
+    /**
+     * @param name uniform name as written in the shader source
+     * @return a handle for the setters below, or -1 if the uniform is not active
+     */
+    int uniformIndex(const char* name) const;
+
+    /**
+     * @param name attribute name as written in the shader source
+     * @return the attribute location, or -1 if the attribute is not active
+     */
+    GLint attribLocation(const char* name) const;
+
+    /**
+     * Attaches a uniform block to a uniform buffer binding point
+     * @param name block name as written in the shader source
+     * @param binding binding point the block's buffer range will be bound to
+     * @return false if the program has no such active block
+     */
+    bool bindUniformBlock(const char* name, GLuint binding) const;
+
+    // Uniform setters.  index comes from uniformIndex(); -1 is ignored so
+    // callers don't need to care whether the driver optimized a uniform out.
+    void setUniform(int index, GLint value);
+    void setUniform(int index, GLfloat value);
+    void setUniform(int index, const glm::vec2& value);
+    void setUniform(int index, const glm::vec3& value);
+    void setUniform(int index, const glm::vec4& value);
+    void setUniform(int index, const glm::mat4& value);
+
+    const std::vector<Variable>& uniforms() const { return mUniforms; }
+    const std::vector<Variable>& attributes() const { return mAttributes; }
+
+    /**
+     * @return number of uniform uploads actually sent to GL
+     */
+    uint64_t uniformUploads() const { return mUniformUploads; }
+
+    /**
+     * @return number of uniform uploads dropped because the value was unchanged
+     */
+    uint64_t uniformUploadsSkipped() const { return mUniformUploadsSkipped; }
+
+private:
+    /**
+     * Compares value against the uniform's shadow copy and updates it
+     * @return true if the value changed and must be sent to GL
+     */
+    bool updateShadow(int index, GLenum type, const void* value, size_t bytes);
+
+    GLuint mProgram;
+    std::vector<Variable> mUniforms;
+    std::vector<Variable> mAttributes;
+    std::vector<uint8_t> mShadow;
+    uint64_t mUniformUploads;
+    uint64_t mUniformUploadsSkipped;
+};
+
+#endif //JNIDEMO_SHADERPROGRAM_H
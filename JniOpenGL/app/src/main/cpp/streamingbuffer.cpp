@@ -0,0 +1,175 @@
+#include "streamingbuffer.h"
+#include <android/log.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#define  LOG_TAG    "streamingbuffer"
+#define  LOGI(...)  __android_log_print(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+/**
+ * How long a single glClientWaitSync may block before we check again, in nanoseconds
+ */
+static const GLuint64 kFenceWaitSliceNanos = 1000000;
+
+StreamingVertexBuffer::StreamingVertexBuffer() :
+        mBufferID(0),
+        mCapacity(0),
+        mHead(0),
+        mTail(0),
+        mUsed(0),
+        mFrameUsed(0),
+        mFrameBytes(0),
+        mFrameWaitNanos(0),
+        mLastFrameBytes(0),
+        mLastFrameWaitNanos(0),
+        mTotalBytes(0),
+        mTotalWaitNanos(0) {
+}
+
+bool StreamingVertexBuffer::init(GLsizeiptr capacity) {
+    reset();
+    mCapacity = capacity;
+    gGl.GenBuffers(1, &mBufferID);
+    gGl.BindBuffer(GL_ARRAY_BUFFER, mBufferID);
+    // allocated once; from here on the storage is only ever written through mappings
+    gGl.BufferData(GL_ARRAY_BUFFER, mCapacity, nullptr, GL_STREAM_DRAW);
+    return mBufferID != 0;
+}
+
+void StreamingVertexBuffer::destroy() {
+    for (const PendingFrame& frame : mPendingFrames) {
+        gGl.DeleteSync(frame.fence);
+    }
+    if (mBufferID) {
+        gGl.DeleteBuffers(1, &mBufferID);
+    }
+    reset();
+}
+
+void StreamingVertexBuffer::reset() {
+    mBufferID = 0;
+    mCapacity = 0;
+    mHead = 0;
+    mTail = 0;
+    mUsed = 0;
+    mFrameUsed = 0;
+    mPendingFrames.clear();
+}
+
+void StreamingVertexBuffer::retireOldestFrame() {
+    PendingFrame& frame = mPendingFrames.front();
+    auto waitStart = std::chrono::steady_clock::now();
+    GLenum status;
+    do {
+        status = gGl.ClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitSliceNanos);
+    } while (status == GL_TIMEOUT_EXPIRED);
+    mFrameWaitNanos += (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - waitStart).count();
+    if (status == GL_WAIT_FAILED) {
+        LOGE("glClientWaitSync failed; streamed vertices may be overwritten in flight");
+    }
+    gGl.DeleteSync(frame.fence);
+    mTail = (mTail + frame.bytes) % mCapacity;
+    mUsed -= frame.bytes;
+    mPendingFrames.pop_front();
+}
+
+bool StreamingVertexBuffer::grow(GLsizeiptr minimumCapacity) {
+    // room for a few frames of the biggest allocation seen so far
+    GLsizeiptr capacity = std::max(mCapacity * 2, minimumCapacity * 3);
+    LOGI("growing streaming buffer from %ld to %ld bytes", (long) mCapacity, (long) capacity);
+    destroy();
+    return init(capacity);
+}
+
+void* StreamingVertexBuffer::map(GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset) {
+    if (!mBufferID || size <= 0) {
+        return nullptr;
+    }
+    if (size > mCapacity && !grow(size)) {
+        return nullptr;
+    }
+
+    GLintptr start = 0;
+    GLsizeiptr consumed = 0;
+    for (;;) {
+        if (mUsed == 0) {
+            // nothing in flight; start over at the beginning for the largest run of free space
+            mHead = 0;
+            mTail = 0;
+        }
+        GLsizeiptr padding = alignment > 1 ? (alignment - mHead % alignment) % alignment : 0;
+        if (mHead >= mTail && mUsed < mCapacity) {
+            // free space is [mHead, mCapacity) followed by [0, mTail)
+            if (mHead + padding + size <= mCapacity) {
+                start = mHead + padding;
+                consumed = padding + size;
+                break;
+            }
+            if (size <= mTail) {
+                // skip the unusable end of the ring; it's released along with this frame
+                start = 0;
+                consumed = (mCapacity - mHead) + size;
+                break;
+            }
+        } else if (mHead < mTail && mHead + padding + size <= mTail) {
+            start = mHead + padding;
+            consumed = padding + size;
+            break;
+        }
+        if (mPendingFrames.empty()) {
+            // the current frame alone has filled the ring
+            if (!grow(mFrameUsed + size)) {
+                return nullptr;
+            }
+            continue;
+        }
+        retireOldestFrame();
+    }
+
+    gGl.BindBuffer(GL_ARRAY_BUFFER, mBufferID);
+    void* mapped = gGl.MapBufferRange(GL_ARRAY_BUFFER, start, size,
+                                      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!mapped) {
+        return nullptr;
+    }
+    mHead = (start + size) % mCapacity;
+    mUsed += consumed;
+    mFrameUsed += consumed;
+    mFrameBytes += (uint64_t) size;
+    *offset = start;
+    return mapped;
+}
+
+void StreamingVertexBuffer::unmap() {
+    gGl.UnmapBuffer(GL_ARRAY_BUFFER);
+}
+
+GLintptr StreamingVertexBuffer::write(const void* data, GLsizeiptr size, GLsizeiptr alignment) {
+    GLintptr offset = -1;
+    void* mapped = map(size, alignment, &offset);
+    if (!mapped) {
+        return -1;
+    }
+    memcpy(mapped, data, (size_t) size);
+    unmap();
+    return offset;
+}
+
+void StreamingVertexBuffer::endFrame() {
+    if (mBufferID && mFrameUsed > 0) {
+        PendingFrame frame;
+        frame.fence = gGl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        frame.bytes = mFrameUsed;
+        mPendingFrames.push_back(frame);
+    }
+    mLastFrameBytes.store(mFrameBytes, std::memory_order_relaxed);
+    mLastFrameWaitNanos.store(mFrameWaitNanos, std::memory_order_relaxed);
+    mTotalBytes.fetch_add(mFrameBytes, std::memory_order_relaxed);
+    mTotalWaitNanos.fetch_add(mFrameWaitNanos, std::memory_order_relaxed);
+    mFrameUsed = 0;
+    mFrameBytes = 0;
+    mFrameWaitNanos = 0;
+}
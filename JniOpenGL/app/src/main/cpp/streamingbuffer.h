@@ -0,0 +1,132 @@
+#ifndef JNIDEMO_STREAMINGBUFFER_H
+#define JNIDEMO_STREAMINGBUFFER_H
+
+#include "gldispatch.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+
+/**
+ * Ring allocator for vertex data that is rewritten by the CPU every frame.
+ *
+ * Instead of re-specifying a buffer with glBufferData each frame (which makes
+ * the driver orphan and reallocate it), every frame's data is sub-allocated
+ * from one large buffer, written through an unsynchronized mapping, and
+ * fenced at endFrame().  Space is only reused once the fence of the frame
+ * that last used it has signaled, so the GPU never reads half-written data
+ * and the CPU only waits when it gets a whole ring ahead of the GPU.
+ *
+ * Allocation happens on the GL thread; the statistics can be read from any thread.
+ */
+class StreamingVertexBuffer {
+public:
+    StreamingVertexBuffer();
+
+    /**
+     * Creates the ring buffer.  Must be called on the GL thread.
+     * @param capacity ring size in bytes; it grows if a single allocation doesn't fit
+     */
+    bool init(GLsizeiptr capacity);
+
+    /**
+     * Deletes the buffer and any pending fences
+     */
+    void destroy();
+
+    /**
+     * Forgets the buffer and fences without deleting them, e.g. after context loss
+     */
+    void reset();
+
+    GLuint id() const { return mBufferID; }
+
+    /**
+     * Reserves and maps size bytes of the ring, waiting for the GPU if the
+     * ring is full.  The buffer is left bound to GL_ARRAY_BUFFER.  Every
+     * map() must be followed by unmap() before drawing.
+     * @param size number of bytes to write
+     * @param alignment required alignment of the returned offset, e.g. the vertex stride
+     * @param offset receives the offset of the allocation within id()
+     * @return where to write the data, or nullptr if the buffer couldn't be mapped
+     */
+    void* map(GLsizeiptr size, GLsizeiptr alignment, GLintptr* offset);
+
+    void unmap();
+
+    /**
+     * Convenience for map() + memcpy + unmap()
+     * @return the offset of the data within id(), or -1 on failure
+     */
+    GLintptr write(const void* data, GLsizeiptr size, GLsizeiptr alignment);
+
+    /**
+     * Fences off everything allocated since the previous endFrame() and
+     * publishes this frame's statistics.  Call after the frame's last draw.
+     */
+    void endFrame();
+
+    /**
+     * @return bytes written during the last completed frame
+     */
+    uint64_t lastFrameBytes() const { return mLastFrameBytes.load(std::memory_order_relaxed); }
+
+    /**
+     * @return nanoseconds spent waiting for the GPU during the last completed frame
+     */
+    uint64_t lastFrameWaitNanos() const { return mLastFrameWaitNanos.load(std::memory_order_relaxed); }
+
+    uint64_t totalBytes() const { return mTotalBytes.load(std::memory_order_relaxed); }
+    uint64_t totalWaitNanos() const { return mTotalWaitNanos.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * A completed frame whose data the GPU may still be reading
+     */
+    struct PendingFrame {
+        GLsync fence;
+        /**
+         * bytes of the ring the frame used, including alignment and wrap-around padding
+         */
+        GLsizeiptr bytes;
+    };
+
+    /**
+     * Blocks until the oldest pending frame is done and returns its space to the ring
+     */
+    void retireOldestFrame();
+
+    /**
+     * Replaces the ring with a bigger one; the old buffer stays alive in the
+     * driver until the GPU is done with it
+     */
+    bool grow(GLsizeiptr minimumCapacity);
+
+    GLuint mBufferID;
+    GLsizeiptr mCapacity;
+    /**
+     * where the next allocation starts
+     */
+    GLintptr mHead;
+    /**
+     * start of the oldest data the GPU may still be reading
+     */
+    GLintptr mTail;
+    /**
+     * bytes between mTail and mHead, wrapping around the end of the ring
+     */
+    GLsizeiptr mUsed;
+    /**
+     * ring bytes consumed by the current frame so far
+     */
+    GLsizeiptr mFrameUsed;
+    std::deque<PendingFrame> mPendingFrames;
+
+    uint64_t mFrameBytes;
+    uint64_t mFrameWaitNanos;
+    std::atomic<uint64_t> mLastFrameBytes;
+    std::atomic<uint64_t> mLastFrameWaitNanos;
+    std::atomic<uint64_t> mTotalBytes;
+    std::atomic<uint64_t> mTotalWaitNanos;
+};
+
+#endif //JNIDEMO_STREAMINGBUFFER_H
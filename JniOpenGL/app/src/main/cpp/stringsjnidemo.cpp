@@ -1,203 +1,373 @@
 #include <jni.h>
-#include <string>
+#include "corpusfile.h"
+#include "jnibridge.h"
+#include "phrasecorpus.h"
+#include "phraseenumerator.h"
+#include "phrasegenerator.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <random>
-#include <iostream>
+#include <vector>
 #include <android/log.h>
 
 /**
- * These will be the first adjective, with a -ly added to modify the second adjective
+ * Random state for phrase generation.  Each thread gets its own, seeded once
+ * from std::random_device the first time that thread asks for a phrase, so
+ * generating a phrase costs a few engine steps rather than a device read
+ * and a 5KB Mersenne Twister setup.
  */
-std::string adjective1Corpus[] = {
-        "Abaft",
-        "Abandoned",
-        "Abased",
-        "Abashed",
-        "Abasic",
-        "Abbatial",
-        "Abdicable",
-        "Abdicant",
-        "Abdicative",
-        "Abdominal",
-        "Abdominous",
-        "Abducent",
-        "Aberrant",
-        "Aberrational",
-        "Abeyant",
-        "Abhorrent",
-        "Abiotic",
-        "Ablaze",
-        "Able",
-        "Ablebodied",
-        "Ablutophobic",
-        "Abnormal",
-        "Abolitionary",
-        "Abominable",
-        "Aboriginal",
-        "Above",
-        "Aboveground",
-        "Abrupt",
-        "Absent",
-        "Absentminded",
-        "Absolute",
-        "Absolutistic",
-        "Abstract",
-        "Abstracted",
-        "Absurd",
-        "Abusive",
-        "Abysmal",
-        "Abyssal"
+struct PhraseRandom {
+    std::mt19937 engine;
+    // uniform distributions from 0 to word count-1 for each word list
+    std::uniform_int_distribution<uint32_t> adjective1Index;
+    std::uniform_int_distribution<uint32_t> adjective2Index;
+    std::uniform_int_distribution<uint32_t> animalIndex;
+    // range of string count
+    std::uniform_int_distribution<uint32_t> wordCount;
+
+    PhraseRandom() :
+            engine(std::random_device()()),
+            wordCount(1, 3) {
+    }
+
+    /**
+     * Sizes the index distributions for corpus, unless they already fit it
+     */
+    void bind(const PhraseCorpus& corpus) {
+        if (animalIndex.max() != corpus.animal.count - 1
+            || adjective1Index.max() != corpus.adjective1.count - 1
+            || adjective2Index.max() != corpus.adjective2.count - 1) {
+            adjective1Index = std::uniform_int_distribution<uint32_t>(0, corpus.adjective1.count - 1);
+            adjective2Index = std::uniform_int_distribution<uint32_t>(0, corpus.adjective2.count - 1);
+            animalIndex = std::uniform_int_distribution<uint32_t>(0, corpus.animal.count - 1);
+        }
+    }
 };
+
 /**
- * These will be the primary adjectives to modify the animal
+ * @return the calling thread's phrase random state
  */
-std::string adjective2Corpus[] = {
-        "Nyctophobic",
-        "Nylon",
-        "OAFISH",
-        "OBEDIENT",
-        "OBELISKOID",
-        "OBESE",
-        "OBJECTIVE",
-        "OBLIVIOUS",
-        "OBLONG",
-        "OBNOXIOUS",
-        "OBSCENE",
-        "OBSEQUIOUS",
-        "OBSERVANT",
-        "OBSESSIVE",
-        "OBSIDIAN",
-        "OBSOLETE",
-        "OBTUSE",
-        "OBVIOUS",
-        "OCCASIONAL",
-        "OCCUPATIONAL",
-        "OCEANGOING",
-        "OCEANIC",
-        "OCEANLIKE",
-        "OCEANOGRAPHIC",
-        "OCEANOGRAPHICAL",
-        "OCHRE",
-        "OCTAGONAL"
-};
+static PhraseRandom& threadPhraseRandom() {
+    thread_local PhraseRandom random;
+    return random;
+}
+
 /**
- * Animals to be described
+ * @return the corpus loaded through loadCorpus, if any.  A function-local
+ *         static, so loading the library still runs no static constructors.
  */
-std::string animalCorpus[] = {
-        "maltesedog",
-        "mamba",
-        "mamenchisaurus",
-        "mammal",
-        "mammoth",
-        "manatee",
-        "mandrill",
-        "mangabey",
-        "manta",
-        "mantaray",
-        "mantid",
-        "mantis",
-        "mantisray",
-        "manxcat",
-        "mara",
-        "marabou",
-        "marbledmurrelet",
-        "mare",
-        "marlin",
-        "marmoset",
-        "marmot",
-        "marten",
-        "martin",
-        "massasauga",
-        "massospondylus",
-        "mastiff",
-        "mastodon",
-        "mayfly",
-        "meadowhawk",
-        "meadowlark",
-        "mealworm",
-        "meerkat",
-        "megalosaurus",
-        "megalotomusquinquespinosus",
-        "megaraptor",
-        "merganser",
-        "merlin",
-        "metalmarkbutterfly",
-        "metamorphosis",
-        "mice",
-        "microvenator",
-        "midge",
-        "milksnake",
-        "milkweedbug",
-        "millipede",
-        "minibeast",
-        "mink",
-        "minnow",
-        "mite",
-        "moa",
-        "mockingbird",
-        "mole",
-        "mollies",
-        "mollusk",
-        "molly",
-        "monarch",
-        "mongoose",
-        "mongrel"
-};
-std::string testStrings[] = {"hello","world"};
+static std::shared_ptr<MappedCorpus>& loadedCorpus() {
+    static std::shared_ptr<MappedCorpus> corpus;
+    return corpus;
+}
+
+/**
+ * @return the corpus phrases are currently generated from.  Holding on to
+ *         the result keeps a mapped corpus alive even if another corpus is
+ *         loaded meanwhile.
+ */
+static std::shared_ptr<const PhraseCorpus> activeCorpus() {
+    std::shared_ptr<MappedCorpus> mapped = std::atomic_load(&loadedCorpus());
+    if (mapped) {
+        return std::shared_ptr<const PhraseCorpus>(mapped, &mapped->corpus());
+    }
+    // the built-in corpus is never freed, so it needs no owner
+    return std::shared_ptr<const PhraseCorpus>(std::shared_ptr<const PhraseCorpus>(), &builtinCorpus());
+}
+
+/**
+ * @return a buffer on the calling thread big enough for any phrase of corpus;
+ *         it only reallocates when a corpus with longer words is loaded
+ */
+static char* threadPhraseBuffer(const PhraseCorpus& corpus) {
+    thread_local std::vector<char> buffer(kBuiltinPhraseBufferBytes);
+    if (buffer.size() < corpus.maxPhraseLength() + 1) {
+        buffer.resize(corpus.maxPhraseLength() + 1);
+    }
+    return buffer.data();
+}
+
+/**
+ * @return a UTF-16 buffer on the calling thread big enough for any phrase of corpus
+ */
+static jchar* threadPhraseUnits(const PhraseCorpus& corpus) {
+    thread_local std::vector<jchar> units(kBuiltinPhraseBufferBytes);
+    if (units.size() < corpus.maxPhraseLength()) {
+        units.resize(corpus.maxPhraseLength());
+    }
+    return units.data();
+}
+
+/**
+ * @return an offsets-and-lengths table on the calling thread with room for
+ *         count phrases; it only reallocates when a bigger batch is asked for
+ */
+static jint* threadPhraseTable(jint count) {
+    thread_local std::vector<jint> table;
+    if (table.size() < 2 * (size_t) count) {
+        table.resize(2 * (size_t) count);
+    }
+    return table.data();
+}
+
+/**
+ * Picks the words of one random {adjective-ly adjective animal} phrase
+ * @param random the calling thread's random state, bound to the corpus
+ */
+static PhraseIndices randomIndices(PhraseRandom& random) {
+    // generate a random index for each word list, and choose randomly
+    // between 1 and 3 words.  The phrase always includes at least the noun
+    // and up to 2 adjectives.  Naturally, the code doesn't work without the
+    // animal (or, at least, it shouldn't).
+    PhraseIndices indices;
+    indices.adjective1 = random.adjective1Index(random.engine);
+    indices.adjective2 = random.adjective2Index(random.engine);
+    indices.animal = random.animalIndex(random.engine);
+    indices.wordCount = random.wordCount(random.engine);
+    return indices;
+}
+
+/**
+ * Writes one random {adjective-ly adjective animal} phrase
+ * @param random the calling thread's random state, bound to corpus
+ * @param corpus where the words come from
+ * @param out receives the phrase; must hold corpus.maxPhraseLength() + 1 bytes
+ * @return length of the phrase
+ */
+static size_t randomPhrase(PhraseRandom& random, const PhraseCorpus& corpus, char* out) {
+    return writePhrase(corpus, randomIndices(random), out);
+}
+
+/**
+ * Creates the Java string of a phrase.  The phrase is assembled directly in
+ * UTF-16 and handed to NewString, which copies it as is.  NewStringUTF would
+ * have ART validate and transcode modified UTF-8, and the standard UTF-8 of
+ * supplementary characters isn't valid modified UTF-8 at all.
+ * @return the string, or nullptr with an OutOfMemoryError pending
+ */
+static jstring newPhraseString(JNIEnv* env, const PhraseCorpus& corpus, const PhraseIndices& indices) {
+    jchar* units = threadPhraseUnits(corpus);
+    size_t length = writePhraseUtf16(corpus, indices, (uint16_t*) units);
+    return env->NewString(units, (jsize) length);
+}
+
 extern "C" JNIEXPORT jstring JNICALL
 Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomString(
         JNIEnv *env,
         jobject thiz) {
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    PhraseRandom& random = threadPhraseRandom();
+    random.bind(*corpus);
+    PhraseIndices indices = randomIndices(random);
+    char* animalWorthyOfWindyDescription = threadPhraseBuffer(*corpus);
+    writePhrase(*corpus, indices, animalWorthyOfWindyDescription);
 
-    // random value from 0 to the size of our text corpi, which is calculated
-    // as the entire size of each array divided by the size of String object
+    // native logcat API logging
+    __android_log_print(ANDROID_LOG_DEBUG, "jnigldemo", "JNI returning random adj: %s",
+            animalWorthyOfWindyDescription);
 
-    //Will be used to obtain a seed for the random number engine
-    std::random_device rd;
+    // return jstring of our result to Java
+    return newPhraseString(env, *corpus, indices);
+}
 
-    // mersenne_twister_engine seeded with rd()
-    std::mt19937 randomIndexGenerator(rd());
+extern "C" JNIEXPORT jobjectArray JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomStrings(
+        JNIEnv *env,
+        jobject thiz,
+        jint count) {
+    if (count < 0) {
+        count = 0;
+    }
+    jobjectArray phrases = env->NewObjectArray(count, gJniClasses.string, nullptr);
+    if (!phrases) {
+        // OutOfMemoryError is pending
+        return nullptr;
+    }
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    PhraseRandom& random = threadPhraseRandom();
+    random.bind(*corpus);
+    for (jint i = 0; i < count; i++) {
+        jstring phrase = newPhraseString(env, *corpus, randomIndices(random));
+        if (!phrase) {
+            return nullptr;
+        }
+        env->SetObjectArrayElement(phrases, i, phrase);
+        // don't let hundreds of phrases pile up in the local reference table
+        env->DeleteLocalRef(phrase);
+    }
+    return phrases;
+}
 
-    // uniform distributions from 0 to array length-1 for each array
-    std::uniform_int_distribution<> randomAdj1IndexDistribution(0,
-            (sizeof(adjective1Corpus) / sizeof(std::string))-1);
-    std::uniform_int_distribution<> randomAdj2IndexDistribution(0,
-            (sizeof(adjective2Corpus) / sizeof(std::string))-1);
-    std::uniform_int_distribution<> randomAnimalIndexDistribution(0,
-            (sizeof(animalCorpus) / sizeof(std::string))-1);
+extern "C" JNIEXPORT jint JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomPhrasesToBuffer(
+        JNIEnv *env,
+        jobject thiz,
+        jobject buffer,
+        jintArray offsetsAndLengths,
+        jint count) {
+    char* bytes = (char*) env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (!bytes || capacity < 0 || !offsetsAndLengths || count <= 0) {
+        return 0;
+    }
+    count = std::min<jint>(count, env->GetArrayLength(offsetsAndLengths) / 2);
 
-    // range of string count
-    std::uniform_int_distribution<> randomStringCountDistribution(1,3);
-
-    // generate a random index for each array
-    int adj1Index = randomAdj1IndexDistribution(randomIndexGenerator);
-    int adj2Index = randomAdj2IndexDistribution(randomIndexGenerator);
-    int animalIndex = randomAnimalIndexDistribution(randomIndexGenerator);
-
-    // choose randomly between 1 and 3 strings
-    int stringCount = randomStringCountDistribution(randomIndexGenerator);
-
-    // concat randomly selected strings into a random silly phrase
-    // that includes at least then noun and up to 2 adjectives.
-    // Naturally, the code doesn't work without the animal (or, at least,
-    // it shouldn't).
-    std::string animalWorthyOfWindyDescription;
-    if(stringCount == 3){
-        animalWorthyOfWindyDescription = adjective1Corpus[adj1Index] +
-                "ly " + adjective2Corpus[adj2Index] + " " +
-                animalCorpus[animalIndex];
-    }else if(stringCount == 2){
-        animalWorthyOfWindyDescription = adjective2Corpus[adj2Index] +
-                " " + animalCorpus[animalIndex];
-    }else{
-        animalWorthyOfWindyDescription = animalCorpus[animalIndex];
+    // phrases are generated straight into the ByteBuffer and indexed into a
+    // native table, so no critical region is held while they're generated
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    PhraseRandom& random = threadPhraseRandom();
+    random.bind(*corpus);
+    char* phrase = threadPhraseBuffer(*corpus);
+    const jlong phraseBytes = (jlong) corpus->maxPhraseLength() + 1;
+    jint* table = threadPhraseTable(count);
+    jlong position = 0;
+    jint written = 0;
+    while (written < count) {
+        if (capacity - position >= phraseBytes) {
+            // plenty of room: write in place, the terminator lands in space the next phrase reuses
+            size_t length = randomPhrase(random, *corpus, bytes + position);
+            table[2 * written] = (jint) position;
+            table[2 * written + 1] = (jint) length;
+            position += (jlong) length;
+        } else {
+            // near the end of the buffer, stage the phrase so neither it nor its terminator can overrun
+            size_t length = randomPhrase(random, *corpus, phrase);
+            if ((jlong) length > capacity - position) {
+                break;
+            }
+            memcpy(bytes + position, phrase, length);
+            table[2 * written] = (jint) position;
+            table[2 * written + 1] = (jint) length;
+            position += (jlong) length;
+        }
+        written++;
     }
+    env->SetIntArrayRegion(offsetsAndLengths, 0, 2 * written, table);
+    return written;
+}
 
-    // native logcat API logging
-    __android_log_print(ANDROID_LOG_DEBUG, "jnigldemo", "JNI returning random adj: %s",
-            animalWorthyOfWindyDescription.c_str());
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_seededPhrase(
+        JNIEnv *env,
+        jobject thiz,
+        jlong seed,
+        jlong index) {
+    // a pure function of (seed, index): no state to keep, any row can be regenerated at any time
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    return newPhraseString(env, *corpus, seededPhrase(*corpus, (uint64_t) seed, (uint64_t) index));
+}
 
-    // return jstring of our result std::string to Java
-    return env->NewStringUTF(animalWorthyOfWindyDescription.c_str());
+extern "C" JNIEXPORT jint JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_seededPhrasesToBuffer(
+        JNIEnv *env,
+        jobject thiz,
+        jobject buffer,
+        jintArray offsetsAndLengths,
+        jlong seed,
+        jlong first,
+        jint count) {
+    char* bytes = (char*) env->GetDirectBufferAddress(buffer);
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (!bytes || capacity < 0 || !offsetsAndLengths || count <= 0) {
+        return 0;
+    }
+    count = std::min<jint>(count, env->GetArrayLength(offsetsAndLengths) / 2);
+
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    // the workers fill a native table rather than the Java array: holding a
+    // critical region for a whole multi-core batch would stall the GC, so the
+    // array is only touched by the one copy at the end
+    jint* table = threadPhraseTable(count);
+    size_t written = generatePhrases(*corpus, (uint64_t) seed, (uint64_t) first, (size_t) count,
+                                     bytes, (size_t) capacity, table, WorkerPool::shared());
+    env->SetIntArrayRegion(offsetsAndLengths, 0, 2 * (jsize) written, table);
+    return (jint) written;
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_uniquePhraseCount(
+        JNIEnv *env,
+        jobject thiz) {
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    return (jlong) PhraseEnumerator(*corpus, 0).size();
+}
+
+extern "C" JNIEXPORT jobjectArray JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_uniqueStrings(
+        JNIEnv *env,
+        jobject thiz,
+        jlong key,
+        jlong position,
+        jint count) {
+    std::shared_ptr<const PhraseCorpus> corpus = activeCorpus();
+    PhraseEnumerator enumerator(*corpus, (uint64_t) key);
+    // the sequence is stateless: the caller pages through it by position
+    if (position < 0 || (uint64_t) position >= enumerator.size() || count < 0) {
+        count = 0;
+    } else {
+        count = (jint) std::min<uint64_t>((uint64_t) count, enumerator.size() - (uint64_t) position);
+        enumerator.seek((uint64_t) position);
+    }
+    jobjectArray phrases = env->NewObjectArray(count, gJniClasses.string, nullptr);
+    if (!phrases) {
+        return nullptr;
+    }
+    PhraseIndices indices;
+    for (jint i = 0; i < count && enumerator.next(&indices); i++) {
+        jstring phrase = newPhraseString(env, *corpus, indices);
+        if (!phrase) {
+            return nullptr;
+        }
+        env->SetObjectArrayElement(phrases, i, phrase);
+        env->DeleteLocalRef(phrase);
+    }
+    return phrases;
+}
+
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_jeffcreswell_jniopengl_jni_JniHooks_loadCorpus(
+        JNIEnv *env,
+        jobject thiz,
+        jstring path) {
+    std::shared_ptr<MappedCorpus> mapped;
+    if (path) {
+        const char* pathChars = env->GetStringUTFChars(path, nullptr);
+        if (!pathChars) {
+            return JNI_FALSE;
+        }
+        mapped = std::make_shared<MappedCorpus>();
+        bool opened = mapped->open(pathChars);
+        env->ReleaseStringUTFChars(path, pathChars);
+        if (!opened) {
+            return JNI_FALSE;
+        }
+    }
+    // generators still using the previous corpus keep it mapped until they finish
+    std::atomic_store(&loadedCorpus(), mapped);
+    return JNI_TRUE;
+}
+
+/**
+ * Every native of this file, for JNI_OnLoad to register
+ */
+static const JNINativeMethod kStringNatives[] = {
+        {"randomString", "()Ljava/lang/String;", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomString},
+        {"randomStrings", "(I)[Ljava/lang/String;",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomStrings},
+        {"randomPhrasesToBuffer", "(Ljava/nio/ByteBuffer;[II)I",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_randomPhrasesToBuffer},
+        {"seededPhrase", "(JJ)Ljava/lang/String;", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_seededPhrase},
+        {"seededPhrasesToBuffer", "(Ljava/nio/ByteBuffer;[IJJI)I",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_seededPhrasesToBuffer},
+        {"uniquePhraseCount", "()J", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_uniquePhraseCount},
+        {"uniqueStrings", "(JJI)[Ljava/lang/String;",
+                (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_uniqueStrings},
+        {"loadCorpus", "(Ljava/lang/String;)Z", (void*) Java_com_jeffcreswell_jniopengl_jni_JniHooks_loadCorpus},
+};
+
+bool registerStringNatives(JNIEnv* env, jclass hooks) {
+    return env->RegisterNatives(hooks, kStringNatives, sizeof(kStringNatives) / sizeof(kStringNatives[0])) == JNI_OK;
 }
 
 /*
@@ -256,5 +426,3 @@ Java_com_jeffcreswell_jniopengl_jni_JniHooks_testString(
 /*
 }
 */
-
-
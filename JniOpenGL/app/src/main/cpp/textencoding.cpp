@@ -0,0 +1,143 @@
+#include "textencoding.h"
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+static const uint16_t kReplacementCharacter = 0xfffd;
+
+bool isAscii(const char* bytes, size_t length) {
+    const uint8_t* in = (const uint8_t*) bytes;
+    size_t i = 0;
+#if defined(__SSE2__)
+    // OR blocks together and test the high bits once per 64 bytes
+    for (; i + 64 <= length; i += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (in + i));
+        __m128i b = _mm_loadu_si128((const __m128i*) (in + i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*) (in + i + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*) (in + i + 48));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+            return false;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        if (_mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (in + i)))) {
+            return false;
+        }
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 64 <= length; i += 64) {
+        uint8x16_t a = vld1q_u8(in + i);
+        uint8x16_t b = vld1q_u8(in + i + 16);
+        uint8x16_t c = vld1q_u8(in + i + 32);
+        uint8x16_t d = vld1q_u8(in + i + 48);
+        uint8x16_t any = vorrq_u8(vorrq_u8(a, b), vorrq_u8(c, d));
+#if defined(__aarch64__)
+        if (vmaxvq_u8(any) >= 0x80) {
+            return false;
+        }
+#else
+        uint8x8_t folded = vorr_u8(vget_low_u8(any), vget_high_u8(any));
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) & 0x8080808080808080ull) {
+            return false;
+        }
+#endif
+    }
+#endif
+    // whatever is left, a word at a time
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, in + i, sizeof(word));
+        if (word & 0x8080808080808080ull) {
+            return false;
+        }
+    }
+    for (; i < length; i++) {
+        if (in[i] & 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void widenAscii(const char* bytes, size_t length, uint16_t* out) {
+    const uint8_t* in = (const uint8_t*) bytes;
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*) (in + i));
+        _mm_storeu_si128((__m128i*) (out + i), _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128((__m128i*) (out + i + 8), _mm_unpackhi_epi8(block, zero));
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t block = vld1q_u8(in + i);
+        vst1q_u16(out + i, vmovl_u8(vget_low_u8(block)));
+        vst1q_u16(out + i + 8, vmovl_u8(vget_high_u8(block)));
+    }
+#endif
+    for (; i < length; i++) {
+        out[i] = in[i];
+    }
+}
+
+size_t utf8ToUtf16(const char* bytes, size_t length, uint16_t* out) {
+    const uint8_t* in = (const uint8_t*) bytes;
+    size_t written = 0;
+    size_t i = 0;
+    while (i < length) {
+        const uint8_t lead = in[i];
+        if (lead < 0x80) {
+            out[written++] = lead;
+            i++;
+            continue;
+        }
+        // sequence length, and the smallest code point it may encode
+        size_t count;
+        uint32_t minimum;
+        uint32_t codePoint;
+        if ((lead & 0xe0) == 0xc0) {
+            count = 2;
+            minimum = 0x80;
+            codePoint = lead & 0x1f;
+        } else if ((lead & 0xf0) == 0xe0) {
+            count = 3;
+            minimum = 0x800;
+            codePoint = lead & 0x0f;
+        } else if ((lead & 0xf8) == 0xf0) {
+            count = 4;
+            minimum = 0x10000;
+            codePoint = lead & 0x07;
+        } else {
+            out[written++] = kReplacementCharacter;
+            i++;
+            continue;
+        }
+        bool valid = i + count <= length;
+        for (size_t k = 1; valid && k < count; k++) {
+            valid = (in[i + k] & 0xc0) == 0x80;
+            codePoint = (codePoint << 6) | (in[i + k] & 0x3f);
+        }
+        valid = valid && codePoint >= minimum && codePoint <= 0x10ffff
+                && (codePoint < 0xd800 || codePoint > 0xdfff);
+        if (!valid) {
+            // resynchronise at the next byte
+            out[written++] = kReplacementCharacter;
+            i++;
+            continue;
+        }
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            out[written++] = (uint16_t) (0xd800 | (codePoint >> 10));
+            out[written++] = (uint16_t) (0xdc00 | (codePoint & 0x3ff));
+        } else {
+            out[written++] = (uint16_t) codePoint;
+        }
+        i += count;
+    }
+    return written;
+}
@@ -0,0 +1,30 @@
+#ifndef JNIDEMO_TEXTENCODING_H
+#define JNIDEMO_TEXTENCODING_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @return true if every byte is below 0x80.  Checks 64 bytes per iteration
+ *         with SSE2 or NEON where available.
+ */
+bool isAscii(const char* bytes, size_t length);
+
+/**
+ * Converts ASCII to UTF-16 by zero-extending each byte, 16 at a time with
+ * SSE2 or NEON where available
+ * @param out receives length code units
+ */
+void widenAscii(const char* bytes, size_t length, uint16_t* out);
+
+/**
+ * Decodes UTF-8 to UTF-16.  Characters above U+FFFF become surrogate pairs;
+ * malformed, overlong or surrogate-encoding sequences decode as one U+FFFD
+ * per offending byte, so the result never has more code units than the
+ * input has bytes.
+ * @param out receives the code units; must hold length of them
+ * @return number of code units written
+ */
+size_t utf8ToUtf16(const char* bytes, size_t length, uint16_t* out);
+
+#endif //JNIDEMO_TEXTENCODING_H
@@ -0,0 +1,89 @@
+#include "transformhierarchy.h"
+#include <algorithm>
+
+/**
+ * @return translation * rotation * scale, built directly rather than by
+ *         multiplying three matrices
+ */
+static glm::mat4 composeLocal(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+    glm::mat4 local = glm::mat4_cast(rotation);
+    local[0] *= scale.x;
+    local[1] *= scale.y;
+    local[2] *= scale.z;
+    local[3] = glm::vec4(translation, 1.0f);
+    return local;
+}
+
+TransformHierarchy::TransformHierarchy() :
+        mFirstDirty(0) {
+}
+
+int32_t TransformHierarchy::addNode(int32_t parent, const glm::vec3& translation, const glm::quat& rotation,
+                                    const glm::vec3& scale) {
+    // requiring parents to exist already keeps the arrays topologically sorted
+    if (parent != kNoParent && (parent < 0 || (size_t) parent >= size())) {
+        return kNoParent;
+    }
+    int32_t node = (int32_t) size();
+    mParent.push_back(parent);
+    mTranslation.push_back(translation);
+    mRotation.push_back(rotation);
+    mScale.push_back(scale);
+    mWorld.push_back(glm::mat4(1.0f));
+    mDirty.push_back(0);
+    mRecomputed.push_back(0);
+    markDirty(node);
+    return node;
+}
+
+void TransformHierarchy::clear() {
+    mParent.clear();
+    mTranslation.clear();
+    mRotation.clear();
+    mScale.clear();
+    mWorld.clear();
+    mDirty.clear();
+    mRecomputed.clear();
+    mFirstDirty = 0;
+}
+
+void TransformHierarchy::markDirty(int32_t node) {
+    mDirty[node] = 1;
+    mFirstDirty = std::min(mFirstDirty, (size_t) node);
+}
+
+void TransformHierarchy::setTranslation(int32_t node, const glm::vec3& translation) {
+    mTranslation[node] = translation;
+    markDirty(node);
+}
+
+void TransformHierarchy::setRotation(int32_t node, const glm::quat& rotation) {
+    mRotation[node] = rotation;
+    markDirty(node);
+}
+
+void TransformHierarchy::setScale(int32_t node, const glm::vec3& scale) {
+    mScale[node] = scale;
+    markDirty(node);
+}
+
+size_t TransformHierarchy::update() {
+    const size_t count = size();
+    size_t recomputed = 0;
+    for (size_t i = mFirstDirty; i < count; i++) {
+        const int32_t parent = mParent[i];
+        // a parent before mFirstDirty is unchanged, and its mRecomputed flag is stale
+        const bool parentChanged = parent != kNoParent && (size_t) parent >= mFirstDirty && mRecomputed[parent];
+        if (!mDirty[i] && !parentChanged) {
+            mRecomputed[i] = 0;
+            continue;
+        }
+        glm::mat4 local = composeLocal(mTranslation[i], mRotation[i], mScale[i]);
+        mWorld[i] = parent == kNoParent ? local : mWorld[parent] * local;
+        mDirty[i] = 0;
+        mRecomputed[i] = 1;
+        recomputed++;
+    }
+    mFirstDirty = count;
+    return recomputed;
+}
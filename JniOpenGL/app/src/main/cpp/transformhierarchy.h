@@ -0,0 +1,92 @@
+#ifndef JNIDEMO_TRANSFORMHIERARCHY_H
+#define JNIDEMO_TRANSFORMHIERARCHY_H
+
+#include "glm/glm.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Scene graph of transforms stored as flat arrays indexed by node.
+ *
+ * Every node refers to its parent by index, and parents always come before
+ * their children, so one forward pass over the arrays visits every parent
+ * before any of its children -- no recursion and no pointer chasing.  Local
+ * translation, rotation and scale live in separate arrays (structure of
+ * arrays) so setters and the update pass touch only the data they need.
+ *
+ * World matrices are cached.  Changing a node's local transform only marks
+ * it dirty; update() then recomputes the world matrices of dirty nodes and
+ * their descendants, starting at the first dirty node, and leaves every
+ * other matrix alone.  Static parts of a scene cost nothing per frame.
+ */
+class TransformHierarchy {
+public:
+    static const int32_t kNoParent = -1;
+
+    TransformHierarchy();
+
+    /**
+     * Appends a node
+     * @param parent index of an existing node, or kNoParent for a root
+     * @return index of the new node, or kNoParent if parent doesn't exist
+     */
+    int32_t addNode(int32_t parent,
+                    const glm::vec3& translation = glm::vec3(0.0f),
+                    const glm::quat& rotation = glm::quat(),
+                    const glm::vec3& scale = glm::vec3(1.0f));
+
+    /**
+     * Removes every node
+     */
+    void clear();
+
+    size_t size() const { return mParent.size(); }
+
+    int32_t parent(int32_t node) const { return mParent[node]; }
+
+    const glm::vec3& translation(int32_t node) const { return mTranslation[node]; }
+    const glm::quat& rotation(int32_t node) const { return mRotation[node]; }
+    const glm::vec3& scale(int32_t node) const { return mScale[node]; }
+
+    // Local transform setters; each marks the node's subtree for recomputation
+    void setTranslation(int32_t node, const glm::vec3& translation);
+    void setRotation(int32_t node, const glm::quat& rotation);
+    void setScale(int32_t node, const glm::vec3& scale);
+
+    /**
+     * Brings the world matrices of dirty subtrees up to date
+     * @return number of world matrices recomputed
+     */
+    size_t update();
+
+    /**
+     * @return the node's world matrix as of the last update()
+     */
+    const glm::mat4& world(int32_t node) const { return mWorld[node]; }
+
+private:
+    void markDirty(int32_t node);
+
+    std::vector<int32_t> mParent;
+    std::vector<glm::vec3> mTranslation;
+    std::vector<glm::quat> mRotation;
+    std::vector<glm::vec3> mScale;
+    std::vector<glm::mat4> mWorld;
+    /**
+     * nodes whose local transform changed since the last update()
+     */
+    std::vector<uint8_t> mDirty;
+    /**
+     * scratch for update(): nodes whose world matrix was recomputed this pass
+     */
+    std::vector<uint8_t> mRecomputed;
+    /**
+     * lowest dirty node index, or size() if nothing is dirty; nodes before
+     * it can't be affected by any change
+     */
+    size_t mFirstDirty;
+};
+
+#endif //JNIDEMO_TRANSFORMHIERARCHY_H
@@ -0,0 +1,135 @@
+#include "uniformring.h"
+#include <android/log.h>
+#include <chrono>
+#include <cstring>
+
+#define  LOG_TAG    "uniformring"
+#define  LOGE(...)  __android_log_print(ANDROID_LOG_ERROR,LOG_TAG,__VA_ARGS__)
+
+/**
+ * How long a single glClientWaitSync may block before we check again, in nanoseconds
+ */
+static const GLuint64 kFenceWaitSliceNanos = 1000000;
+
+const std::string& frameConstantsBlockSource() {
+    // members are explicitly highp so the block matches between the vertex and
+    // fragment stage, which default to different float precisions
+    static const std::string source =
+            "layout(std140) uniform FrameConstants\n"
+            "{\n"
+#define FRAME_CONSTANTS_GLSL(ctype, glsltype, name, align) "    highp " #glsltype " " #name ";\n"
+            FRAME_CONSTANTS_FIELDS(FRAME_CONSTANTS_GLSL)
+#undef FRAME_CONSTANTS_GLSL
+            "};\n";
+    return source;
+}
+
+std::string withFrameConstants(const char* source) {
+    std::string result(source);
+    size_t versionEnd = result.find('\n');
+    if (versionEnd == std::string::npos) {
+        return result;
+    }
+    result.insert(versionEnd + 1, frameConstantsBlockSource());
+    return result;
+}
+
+UniformBufferRing::UniformBufferRing() :
+        mBufferID(0),
+        mAlignedBlockSize(0),
+        mFrameSize(0),
+        mFrame(0),
+        mCursor(0),
+        mFrameAcquired(false),
+        mFences(),
+        mWaitNanos(0) {
+}
+
+bool UniformBufferRing::init(GLsizeiptr blockSize, int blocksPerFrame) {
+    GLint alignment = 0;
+    gGl.GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment <= 0) {
+        alignment = 256;
+    }
+    mAlignedBlockSize = (blockSize + alignment - 1) / alignment * alignment;
+    mFrameSize = mAlignedBlockSize * blocksPerFrame;
+
+    gGl.GenBuffers(1, &mBufferID);
+    gGl.BindBuffer(GL_UNIFORM_BUFFER, mBufferID);
+    gGl.BufferData(GL_UNIFORM_BUFFER, mFrameSize * kFrames, nullptr, GL_DYNAMIC_DRAW);
+    gGl.BindBuffer(GL_UNIFORM_BUFFER, 0);
+    mFrame = 0;
+    mCursor = 0;
+    mFrameAcquired = false;
+    return mBufferID != 0;
+}
+
+void UniformBufferRing::destroy() {
+    for (GLsync& fence : mFences) {
+        if (fence) {
+            gGl.DeleteSync(fence);
+        }
+    }
+    if (mBufferID) {
+        gGl.DeleteBuffers(1, &mBufferID);
+    }
+    reset();
+}
+
+void UniformBufferRing::reset() {
+    mBufferID = 0;
+    for (GLsync& fence : mFences) {
+        fence = nullptr;
+    }
+    mFrame = 0;
+    mCursor = 0;
+    mFrameAcquired = false;
+}
+
+bool UniformBufferRing::upload(const void* data, GLsizeiptr size, GLuint binding) {
+    if (!mBufferID || size > mAlignedBlockSize || mCursor + mAlignedBlockSize > mFrameSize) {
+        return false;
+    }
+    if (!mFrameAcquired) {
+        // the GPU may still be reading what we wrote here kFrames frames ago
+        GLsync& fence = mFences[mFrame];
+        if (fence) {
+            auto waitStart = std::chrono::steady_clock::now();
+            GLenum status;
+            do {
+                status = gGl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitSliceNanos);
+            } while (status == GL_TIMEOUT_EXPIRED);
+            mWaitNanos += (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - waitStart).count();
+            if (status == GL_WAIT_FAILED) {
+                LOGE("glClientWaitSync failed; uniform ring may overwrite data in flight");
+            }
+            gGl.DeleteSync(fence);
+            fence = nullptr;
+        }
+        mFrameAcquired = true;
+    }
+
+    const GLintptr offset = mFrameSize * mFrame + mCursor;
+    gGl.BindBuffer(GL_UNIFORM_BUFFER, mBufferID);
+    void* mapped = gGl.MapBufferRange(GL_UNIFORM_BUFFER, offset, size,
+                                      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!mapped) {
+        return false;
+    }
+    memcpy(mapped, data, (size_t) size);
+    gGl.UnmapBuffer(GL_UNIFORM_BUFFER);
+    gGl.BindBufferRange(GL_UNIFORM_BUFFER, binding, mBufferID, offset, size);
+    mCursor += mAlignedBlockSize;
+    return true;
+}
+
+void UniformBufferRing::endFrame() {
+    if (!mBufferID || !mFrameAcquired) {
+        return;
+    }
+    mFences[mFrame] = gGl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    mFrame = (mFrame + 1) % kFrames;
+    mCursor = 0;
+    mFrameAcquired = false;
+}
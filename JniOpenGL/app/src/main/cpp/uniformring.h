@@ -0,0 +1,124 @@
+#ifndef JNIDEMO_UNIFORMRING_H
+#define JNIDEMO_UNIFORMRING_H
+
+#include "gldispatch.h"
+#include "glm/glm.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Members of the FrameConstants uniform block as
+ * X(C++ type, GLSL type, name, std140 base alignment in bytes).
+ * Both the C++ struct and the GLSL block declaration are generated from this
+ * list, so they can't drift apart.
+ */
+#define FRAME_CONSTANTS_FIELDS(X) \
+    X(glm::mat4, mat4, u_transform, 16) \
+    X(glm::mat4, mat4, u_projection, 16) \
+    X(glm::vec3, vec3, u_color, 16) \
+    X(float, float, u_time, 4)
+
+/**
+ * Per-frame constants shared by every draw in a frame, laid out exactly as
+ * the std140 FrameConstants block in our shaders expects
+ */
+struct FrameConstants {
+#define FRAME_CONSTANTS_MEMBER(ctype, glsltype, name, align) alignas(align) ctype name;
+    FRAME_CONSTANTS_FIELDS(FRAME_CONSTANTS_MEMBER)
+#undef FRAME_CONSTANTS_MEMBER
+};
+static_assert(sizeof(FrameConstants) % 16 == 0, "std140 blocks are padded to a multiple of 16 bytes");
+static_assert(offsetof(FrameConstants, u_time) == 140, "a float packs into the tail of the preceding vec3");
+
+/**
+ * Uniform buffer binding point the FrameConstants block is attached to
+ */
+static const GLuint kFrameConstantsBinding = 0;
+
+/**
+ * @return the GLSL declaration of the FrameConstants block, for pasting into shader sources
+ */
+const std::string& frameConstantsBlockSource();
+
+/**
+ * @param source GLSL source starting with a #version line
+ * @return source with the FrameConstants block declared right after #version
+ */
+std::string withFrameConstants(const char* source);
+
+/**
+ * Triple-buffered uniform buffer for per-frame constant blocks.
+ *
+ * Each frame writes its blocks into its own third of one buffer, mapped with
+ * GL_MAP_UNSYNCHRONIZED_BIT so the driver never stalls or copies on our
+ * behalf.  Safety comes from a fence inserted at endFrame(): before a third
+ * is reused, two frames later, we wait for the GPU to have finished the
+ * frame that last read it.
+ */
+class UniformBufferRing {
+public:
+    static const int kFrames = 3;
+
+    UniformBufferRing();
+
+    /**
+     * Creates the buffer.  Must be called on the GL thread.
+     * @param blockSize size of the largest block that will be uploaded
+     * @param blocksPerFrame number of blocks each frame may upload
+     */
+    bool init(GLsizeiptr blockSize, int blocksPerFrame);
+
+    /**
+     * Deletes the buffer and any pending fences
+     */
+    void destroy();
+
+    /**
+     * Forgets the buffer and fences without deleting them, e.g. after context loss
+     */
+    void reset();
+
+    /**
+     * Copies a block into this frame's part of the ring and binds it
+     * @param data block contents
+     * @param size block size, no larger than the blockSize given to init()
+     * @param binding uniform buffer binding point to attach the block to
+     * @return false if this frame has no room left or the buffer couldn't be mapped
+     */
+    bool upload(const void* data, GLsizeiptr size, GLuint binding);
+
+    template<typename T>
+    bool upload(const T& block, GLuint binding) {
+        return upload(&block, sizeof(T), binding);
+    }
+
+    /**
+     * Fences off this frame's part of the ring and moves on to the next.
+     * Call after the last draw that reads this frame's blocks.
+     */
+    void endFrame();
+
+    /**
+     * @return time spent waiting for the GPU to release ring space, in nanoseconds
+     */
+    uint64_t waitNanos() const { return mWaitNanos; }
+
+private:
+    GLuint mBufferID;
+    GLsizeiptr mAlignedBlockSize;
+    GLsizeiptr mFrameSize;
+    int mFrame;
+    /**
+     * offset of the next block within the current frame's part of the ring
+     */
+    GLsizeiptr mCursor;
+    /**
+     * true once the current frame has waited for its part of the ring
+     */
+    bool mFrameAcquired;
+    GLsync mFences[kFrames];
+    uint64_t mWaitNanos;
+};
+
+#endif //JNIDEMO_UNIFORMRING_H
@@ -0,0 +1,85 @@
+#include "workerpool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t threads) :
+        mStopping(false),
+        mBatch(0),
+        mBusy(0),
+        mTask(nullptr),
+        mTaskCount(0),
+        mNextTask(0) {
+    mThreads.reserve(threads);
+    for (size_t i = 0; i < threads; i++) {
+        mThreads.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStopping = true;
+    }
+    mWake.notify_all();
+    for (std::thread& thread : mThreads) {
+        thread.join();
+    }
+}
+
+WorkerPool& WorkerPool::shared() {
+    // never destroyed: workers may still be parked when the process exits
+    static WorkerPool* pool = new WorkerPool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return *pool;
+}
+
+void WorkerPool::drain() {
+    for (size_t i = mNextTask.fetch_add(1); i < mTaskCount; i = mNextTask.fetch_add(1)) {
+        (*mTask)(i);
+    }
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seenBatch = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mWake.wait(lock, [&] { return mStopping || mBatch != seenBatch; });
+            if (mStopping) {
+                return;
+            }
+            seenBatch = mBatch;
+        }
+        drain();
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mBusy--;
+        }
+        mDone.notify_one();
+    }
+}
+
+void WorkerPool::run(size_t taskCount, const std::function<void(size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> runLock(mRunLock);
+    if (taskCount == 1 || mThreads.empty()) {
+        for (size_t i = 0; i < taskCount; i++) {
+            task(i);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mTask = &task;
+        mTaskCount = taskCount;
+        mNextTask.store(0);
+        mBusy = mThreads.size();
+        mBatch++;
+    }
+    mWake.notify_all();
+    drain();
+    // every worker has to check in before the task can go out of scope
+    std::unique_lock<std::mutex> lock(mLock);
+    mDone.wait(lock, [&] { return mBusy == 0; });
+    mTask = nullptr;
+}
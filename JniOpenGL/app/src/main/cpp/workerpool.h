@@ -0,0 +1,71 @@
+#ifndef JNIDEMO_WORKERPOOL_H
+#define JNIDEMO_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads that run batches of independent tasks.
+ *
+ * run() hands out task numbers through a shared counter, so fast workers
+ * simply take more tasks, and the calling thread works on the batch too
+ * rather than sleeping until it finishes.  Workers never touch JNI, so they
+ * don't need attaching to the VM.
+ */
+class WorkerPool {
+public:
+    /**
+     * @param threads worker threads to start, not counting the thread calling run()
+     */
+    explicit WorkerPool(size_t threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Calls task(i) for every i in [0, taskCount), spread across the workers and
+     * the calling thread, and returns once every call has returned.  Batches
+     * from different threads run one after the other.
+     */
+    void run(size_t taskCount, const std::function<void(size_t)>& task);
+
+    /**
+     * @return threads that work on a batch, including the caller's
+     */
+    size_t concurrency() const { return mThreads.size() + 1; }
+
+    /**
+     * @return the process-wide pool, with one thread per core, started on first use
+     */
+    static WorkerPool& shared();
+
+private:
+    void workerLoop();
+    void drain();
+
+    std::vector<std::thread> mThreads;
+    // serialises run() callers
+    std::mutex mRunLock;
+
+    std::mutex mLock;
+    std::condition_variable mWake;
+    std::condition_variable mDone;
+    bool mStopping;
+    // bumped for every batch so sleeping workers notice a new one
+    uint64_t mBatch;
+    // workers still inside the current batch
+    size_t mBusy;
+
+    const std::function<void(size_t)>* mTask;
+    size_t mTaskCount;
+    std::atomic<size_t> mNextTask;
+};
+
+#endif //JNIDEMO_WORKERPOOL_H
@@ -8,7 +8,6 @@ import android.widget.Button;
 import android.widget.TextView;
 import android.widget.Toast;
 
-import com.jeffcreswell.jniopengl.jni.JniHooks;
 import com.jeffcreswell.jniopengl.ui.GlView;
 import com.jeffcreswell.jniopengl.ui.JniStringItemFragment;
 
@@ -28,7 +27,7 @@ public class MainActivity extends AppCompatActivity implements JniStringItemFrag
         mAddStringsButton.setOnClickListener(new View.OnClickListener() {
             @Override
             public void onClick(View v) {
-                mFragment.pushDataToAdapter(JniHooks.randomString());
+                mFragment.pushDataToAdapter();
             }
         });
     }
@@ -1,5 +1,7 @@
 package com.jeffcreswell.jniopengl.jni;
 
+import java.nio.ByteBuffer;
+
 /**
  * This class provides hooks into the JNI functions of jnidemo-lib
  */
@@ -10,12 +12,26 @@ public class JniHooks {
     }
 
     /**
-     * Initializes native OpenGL rendering context
-     * @param width the width of the GL surface
-     * @param height the height fo the GL surface
+     * Creates the native renderer's GPU resources in the current EGL context.  Only does
+     * work once per context, so it belongs in onSurfaceCreated.
      * @return true if the renderer was initialized successfully, false otherwise
      */
-    public static native boolean glInit(int width, int height);
+    public static native boolean glInit();
+
+    /**
+     * Updates the viewport and projection for a new surface size.  Creates no GPU
+     * resources, so it is cheap enough for every onSurfaceChanged.
+     * @param width the width of the GL surface
+     * @param height the height of the GL surface
+     */
+    public static native void glResize(int width, int height);
+
+    /**
+     * Sets where compiled shader program binaries are cached between runs, so
+     * that {@link #glInit()} can skip shader compilation
+     * @param directory absolute path of the cache directory, or null to disable caching
+     */
+    public static native void glSetProgramCacheDir(String directory);
 
     /**
      * Frees native OpenGL rendering resources
@@ -29,10 +45,147 @@ public class JniHooks {
      */
     public static native void glStepFrame();
 
+    /**
+     * Indices into the summary array filled by {@link #glFrameStats(long[], float[])}
+     */
+    public static final int FRAME_STATS_MEAN_MS = 0;
+    public static final int FRAME_STATS_P50_MS = 1;
+    public static final int FRAME_STATS_P95_MS = 2;
+    public static final int FRAME_STATS_P99_MS = 3;
+    public static final int FRAME_STATS_MAX_MS = 4;
+    public static final int FRAME_STATS_SUMMARY_LENGTH = 5;
+    /**
+     * Number of buckets in the frame time histogram
+     */
+    public static final int FRAME_STATS_HISTOGRAM_BUCKETS = 80;
+
+    /**
+     * Reads the native CPU time statistics of {@link #glStepFrame()} in one call.
+     * Percentiles are estimated from the histogram and are within 12.5% of the true value.
+     * @param histogram receives frame counts per bucket (see {@link #glFrameHistogramBounds(float[])}),
+     *                  or null
+     * @param summary receives mean, p50, p95, p99 and max frame time in milliseconds at the
+     *                FRAME_STATS_* indices, or null
+     * @return number of frames recorded
+     */
+    public static native long glFrameStats(long[] histogram, float[] summary);
+
+    /**
+     * @param upperBoundsMs receives the exclusive upper bound of each histogram bucket in milliseconds,
+     *                      or null
+     * @return number of bounds written
+     */
+    public static native int glFrameHistogramBounds(float[] upperBoundsMs);
+
+    /**
+     * Copies the CPU times of the most recent frames, oldest first, for frame pacing analysis
+     * @param frameMicros receives frame times in microseconds, or null
+     * @return number of frame times written
+     */
+    public static native int glRecentFrameTimes(int[] frameMicros);
+
+    /**
+     * Switches the renderer between the single triangle and instanced mode, in which
+     * count independently animated triangles are drawn with one instanced draw call.
+     * Safe to call from any thread; takes effect on the next frame.
+     * @param count number of instances to draw, or 0 for the single triangle
+     */
+    public static native void glSetInstanceCount(int count);
+
+    /**
+     * Indices into the array filled by {@link #glStreamingStats(long[])}
+     */
+    public static final int STREAMING_STATS_FRAME_BYTES = 0;
+    public static final int STREAMING_STATS_FRAME_WAIT_NANOS = 1;
+    public static final int STREAMING_STATS_TOTAL_BYTES = 2;
+    public static final int STREAMING_STATS_TOTAL_WAIT_NANOS = 3;
+    public static final int STREAMING_STATS_LENGTH = 4;
+
+    /**
+     * Reads how much CPU-animated vertex data was streamed to the GPU, and how long
+     * the GL thread waited for the GPU to free streaming buffer space
+     * @param stats receives bytes and wait nanoseconds of the last frame and in total,
+     *              at the STREAMING_STATS_* indices
+     */
+    public static native void glStreamingStats(long[] stats);
+
     /**
      * Randomly generates an {adjective-ly adjective animal} string and returns it
      * @return random string
      */
     public static native String randomString();
 
+    /**
+     * Switches phrase generation to the words in a binary corpus file.  The file is
+     * memory mapped rather than read, so opening even a huge corpus is instant and
+     * only the words actually sampled are ever loaded.
+     * @param path absolute path of the corpus file, or null to go back to the built-in words
+     * @return false if the file couldn't be mapped or is not a valid corpus; the
+     *         current corpus stays in use in that case
+     */
+    public static native boolean loadCorpus(String path);
+
+    /**
+     * Generates count random {adjective-ly adjective animal} strings in a single
+     * native call, for filling lists without one JNI crossing per item
+     * @param count number of strings to generate
+     * @return array of count random strings
+     */
+    public static native String[] randomStrings(int count);
+
+    /**
+     * Generates up to count random strings as UTF-8 bytes packed back to back into
+     * buffer, without creating any Java objects.  See {@link PhraseBuffer} for a
+     * convenient way to decode individual phrases on demand.
+     * @param buffer a direct ByteBuffer receiving the phrase bytes, from offset 0
+     * @param offsetsAndLengths receives the byte offset and length of phrase i at
+     *                          indices 2 * i and 2 * i + 1
+     * @param count maximum number of phrases to generate
+     * @return number of phrases written; fewer than count if buffer or the table filled up
+     */
+    public static native int randomPhrasesToBuffer(ByteBuffer buffer, int[] offsetsAndLengths, int count);
+
+    /**
+     * Returns phrase number index of the sequence fixed by seed.  The phrase depends
+     * only on seed, index and the current corpus, so a list can regenerate any row
+     * on demand instead of keeping the strings around.  It is the same phrase
+     * {@link #seededPhrasesToBuffer} produces at that index.
+     * @param seed selects the sequence
+     * @param index position in the sequence, from 0
+     * @return the phrase
+     */
+    public static native String seededPhrase(long seed, long index);
+
+    /**
+     * Like {@link #randomPhrasesToBuffer}, but phrases come from a sequence fixed by
+     * seed and are generated on every core.  Phrase i of a seed is always the same,
+     * however many threads there are and however the range is split into calls.
+     * @param buffer a direct ByteBuffer receiving the phrase bytes, from offset 0
+     * @param offsetsAndLengths receives the byte offset and length of phrase i at
+     *                          indices 2 * i and 2 * i + 1
+     * @param seed selects the sequence
+     * @param first index in the sequence of the first phrase to generate
+     * @param count maximum number of phrases to generate
+     * @return number of phrases written; fewer than count if buffer or the table filled up
+     */
+    public static native int seededPhrasesToBuffer(ByteBuffer buffer, int[] offsetsAndLengths,
+                                                   long seed, long first, int count);
+
+    /**
+     * @return how many distinct phrases the current corpus can make, i.e. the length
+     *         of every {@link #uniqueStrings} sequence; 0 if it is too large to enumerate
+     */
+    public static native long uniquePhraseCount();
+
+    /**
+     * Returns part of a shuffled sequence holding every distinct phrase exactly once.
+     * The order depends only on key and the corpus, so pages can be fetched in any
+     * order, or by several callers at once, without ever repeating a phrase.
+     * @param key selects the order
+     * @param position index of the first phrase to return
+     * @param count number of phrases to return
+     * @return the phrases; shorter than count at the end of the sequence
+     */
+    public static native String[] uniqueStrings(long key, long position, int count);
+
 }
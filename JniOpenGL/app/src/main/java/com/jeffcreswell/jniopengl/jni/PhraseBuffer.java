@@ -0,0 +1,62 @@
+package com.jeffcreswell.jniopengl.jni;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+
+/**
+ * A batch of natively generated phrases kept as raw bytes in a direct
+ * {@link ByteBuffer}.  Filling it costs a single JNI call and no Java
+ * allocations; a phrase only becomes a String when {@link #get(int)} asks for it,
+ * e.g. when its row scrolls into view.  The buffer and table are reused by
+ * every {@link #fill(int)}.
+ */
+public class PhraseBuffer {
+
+    private final ByteBuffer mBytes;
+    private final int[] mOffsetsAndLengths;
+    private int mSize;
+
+    /**
+     * @param capacityBytes size of the phrase byte buffer
+     * @param maxPhrases maximum number of phrases a fill can produce
+     */
+    public PhraseBuffer(int capacityBytes, int maxPhrases) {
+        mBytes = ByteBuffer.allocateDirect(capacityBytes);
+        mOffsetsAndLengths = new int[2 * maxPhrases];
+    }
+
+    /**
+     * Replaces the contents with freshly generated phrases
+     * @param count number of phrases wanted
+     * @return number of phrases generated, limited by the buffer's capacities
+     */
+    public int fill(int count) {
+        mSize = JniHooks.randomPhrasesToBuffer(mBytes, mOffsetsAndLengths, count);
+        return mSize;
+    }
+
+    /**
+     * @return number of phrases from the last {@link #fill(int)}
+     */
+    public int size() {
+        return mSize;
+    }
+
+    /**
+     * Decodes a single phrase
+     * @param index phrase index, below {@link #size()}
+     * @return the phrase
+     */
+    public String get(int index) {
+        if (index < 0 || index >= mSize) {
+            throw new IndexOutOfBoundsException("phrase " + index + " of " + mSize);
+        }
+        int offset = mOffsetsAndLengths[2 * index];
+        int length = mOffsetsAndLengths[2 * index + 1];
+        byte[] utf8 = new byte[length];
+        ByteBuffer view = mBytes.duplicate();
+        view.position(offset);
+        view.get(utf8);
+        return new String(utf8, StandardCharsets.UTF_8);
+    }
+}
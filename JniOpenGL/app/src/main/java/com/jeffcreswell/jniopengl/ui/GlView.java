@@ -8,6 +8,8 @@ import android.util.Log;
 
 import com.jeffcreswell.jniopengl.jni.JniHooks;
 
+import java.io.File;
+
 import javax.microedition.khronos.egl.EGL10;
 import javax.microedition.khronos.egl.EGLConfig;
 import javax.microedition.khronos.egl.EGLContext;
@@ -30,6 +32,10 @@ public class GlView extends GLSurfaceView {
         // For demo purposes, we'll go with 8 bits/channel surface configuration.
         setEGLConfigChooser(new ConfigChooser(8,8,8,8,0,0));
 
+        // compiled shader programs are cached in the app's cache dir so that
+        // surface changes and restarts don't recompile them from source
+        JniHooks.glSetProgramCacheDir(new File(context.getCacheDir(), "programs").getAbsolutePath());
+
         // the renderer is responsible for drawing each frame
         setRenderer(new Renderer());
     }
@@ -176,11 +182,15 @@ public class GlView extends GLSurfaceView {
             Log.d(TAG,"onSurfaceChanged; sending width: "+width+" and height: "+height
                     +". For reference, display width is "+ Resources.getSystem().getDisplayMetrics().widthPixels
                     +" and display height is "+Resources.getSystem().getDisplayMetrics().heightPixels);
-            JniHooks.glInit(width,height);
+            JniHooks.glResize(width,height);
         }
 
         public void onSurfaceCreated(GL10 gl, EGLConfig config) {
             Log.d(TAG,"surface created with config {"+config.toString()+"}");
+            // called once per EGL context, so this is where GPU resources get created
+            if (!JniHooks.glInit()) {
+                Log.e(TAG,"native renderer failed to initialize");
+            }
         }
     }
 }
@@ -22,9 +22,12 @@ import com.jeffcreswell.jniopengl.ui.jnistrings.JniStringContent;
 public class JniStringItemFragment extends Fragment {
 
     private static final String ARG_COLUMN_COUNT = "column-count";
+    private static final String STATE_SEED = "phrase-seed";
+    private static final String STATE_SIZE = "phrase-count";
     private int mColumnCount = 1;
     private OnListFragmentInteractionListener mListener;
     private JniStringItemRecyclerViewAdapter mAdapter;
+    private JniStringContent mContent;
 
     /**
      * Mandatory empty constructor for the fragment manager to instantiate the
@@ -49,6 +52,20 @@ public class JniStringItemFragment extends Fragment {
         if (getArguments() != null) {
             mColumnCount = getArguments().getInt(ARG_COLUMN_COUNT);
         }
+        // the seed and item count are all it takes to rebuild the list
+        if (savedInstanceState != null && savedInstanceState.containsKey(STATE_SEED)) {
+            mContent = new JniStringContent(savedInstanceState.getLong(STATE_SEED),
+                    savedInstanceState.getInt(STATE_SIZE));
+        } else {
+            mContent = new JniStringContent();
+        }
+    }
+
+    @Override
+    public void onSaveInstanceState(Bundle outState) {
+        super.onSaveInstanceState(outState);
+        outState.putLong(STATE_SEED, mContent.getSeed());
+        outState.putInt(STATE_SIZE, mContent.size());
     }
 
     @Override
@@ -65,7 +82,7 @@ public class JniStringItemFragment extends Fragment {
             } else {
                 recyclerView.setLayoutManager(new GridLayoutManager(context, mColumnCount));
             }
-            mAdapter = new JniStringItemRecyclerViewAdapter(JniStringContent.ITEMS, mListener);
+            mAdapter = new JniStringItemRecyclerViewAdapter(mContent, mListener);
             recyclerView.setAdapter(mAdapter);
         }
         return view;
@@ -90,11 +107,10 @@ public class JniStringItemFragment extends Fragment {
     }
 
     /**
-     * Push an item of data to the adapter
-     * @param data item to add to the {@link RecyclerView}
+     * Push the next item of data to the adapter
      */
-    public void pushDataToAdapter(String data){
-        mAdapter.pushItem(data);
+    public void pushDataToAdapter(){
+        mAdapter.pushItem();
     }
 
     /**
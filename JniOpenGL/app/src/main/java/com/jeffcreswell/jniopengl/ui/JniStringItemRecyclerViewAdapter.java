@@ -7,20 +7,21 @@ import android.view.ViewGroup;
 import android.widget.TextView;
 import com.jeffcreswell.jniopengl.R;
 import com.jeffcreswell.jniopengl.ui.JniStringItemFragment.OnListFragmentInteractionListener;
-import java.util.List;
+import com.jeffcreswell.jniopengl.ui.jnistrings.JniStringContent;
 
 /**
  * {@link RecyclerView.Adapter} that can display a JNI string and makes a call to the
- * specified {@link OnListFragmentInteractionListener}.
+ * specified {@link OnListFragmentInteractionListener}.  Rows are generated from
+ * their position as they are bound, so the adapter holds no strings.
  *
  */
 public class JniStringItemRecyclerViewAdapter extends RecyclerView.Adapter<JniStringItemRecyclerViewAdapter.JniStringViewHolder> {
 
-    private final List<String> mValues;
+    private final JniStringContent mContent;
     private final OnListFragmentInteractionListener mListener;
 
-    public JniStringItemRecyclerViewAdapter(List<String> items, OnListFragmentInteractionListener listener) {
-        mValues = items;
+    public JniStringItemRecyclerViewAdapter(JniStringContent content, OnListFragmentInteractionListener listener) {
+        mContent = content;
         mListener = listener;
     }
 
@@ -33,7 +34,7 @@ public class JniStringItemRecyclerViewAdapter extends RecyclerView.Adapter<JniSt
 
     @Override
     public void onBindViewHolder(final JniStringViewHolder holder, int position) {
-        holder.mItem = mValues.get(position);
+        holder.mItem = mContent.get(position);
         holder.mPosView.setText(Integer.toString(position));
         holder.mContentView.setText(holder.mItem);
 
@@ -51,16 +52,14 @@ public class JniStringItemRecyclerViewAdapter extends RecyclerView.Adapter<JniSt
 
     @Override
     public int getItemCount() {
-        return mValues.size();
+        return mContent.size();
     }
 
     /**
-     * Adds a string to the adapter data set
-     * @param item a string to be displayed in the {@link RecyclerView}
+     * Adds the next string of the content's sequence to the adapter data set
      */
-    public void pushItem(String item){
-        mValues.add(item);
-        notifyDataSetChanged();
+    public void pushItem(){
+        notifyItemInserted(mContent.addItem());
     }
 
     public class JniStringViewHolder extends RecyclerView.ViewHolder {
@@ -1,42 +1,61 @@
 package com.jeffcreswell.jniopengl.ui.jnistrings;
 
 import com.jeffcreswell.jniopengl.jni.JniHooks;
-import java.util.ArrayList;
-import java.util.List;
+import java.util.Random;
 
 /**
  * Helper class for providing sample randomly selected strings from JNI
  *
+ * No strings are stored: item i is always phrase i of the native sequence
+ * selected by the seed, so any row can be regenerated in O(1) when it scrolls
+ * into view, and the whole list is described by just the seed and its size.
  */
 public class JniStringContent {
 
+    private static final int COUNT = 1;
+
+    private final long mSeed;
+    private int mSize;
+
     /**
-     * An array of sample string from JNI.
+     * Starts a new random list with the default number of sample items
      */
-    public static final List<String> ITEMS = new ArrayList<String>();
+    public JniStringContent() {
+        this(new Random().nextLong(), COUNT);
+    }
 
-    private static final int COUNT = 1;
+    /**
+     * Recreates a list, e.g. from saved instance state
+     * @param seed seed of the list, see {@link #getSeed()}
+     * @param size number of items in the list
+     */
+    public JniStringContent(long seed, int size) {
+        mSeed = seed;
+        mSize = size;
+    }
+
+    public long getSeed() {
+        return mSeed;
+    }
 
-    static {
-        // Add some sample string items to the listview content.
-        for (int i = 1; i <= COUNT; i++) {
-            addItem(createJniStringItem());
-        }
+    public int size() {
+        return mSize;
     }
 
     /**
-     * Adds a JNI string to our {@link #ITEMS} list for easy access by {@link com.jeffcreswell.jniopengl.ui.JniStringItemRecyclerViewAdapter}
-     * @param item a String returned from JNI via {@link #createJniStringItem()}
+     * Reaches out to JNI lib for the string at a position
+     * @param index item position, from 0
+     * @return the item's string; the same every time for a given index
      */
-    private static void addItem(String item) {
-        ITEMS.add(item);
+    public String get(int index) {
+        return JniHooks.seededPhrase(mSeed, index);
     }
 
     /**
-     * Reaches out to JNI lib for random generated String
-     * @return randomly generated string provided by native layer
+     * Appends the next item of the sequence
+     * @return position of the new item
      */
-    private static String createJniStringItem() {
-        return JniHooks.randomString();
+    public int addItem() {
+        return mSize++;
     }
 }